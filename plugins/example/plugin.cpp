@@ -1,5 +1,6 @@
 #include <tideplugin.h>
 
+#include <cstdint>
 #include <string>
 #include <iostream>
 #include <vector>
@@ -20,8 +21,10 @@ public:
     bool setup(const std::string& contents);
     TidePluginAutoCompleterResult* find(const std::string& hint);
     TidePluginAutoCompleterResult* next();
+    const std::vector<uint8_t>& findPacked(const std::string& hint);
 private:
     std::vector<TidePluginAutoCompleterResult> completionResults;
+    std::vector<uint8_t> packedResults;
     std::vector<TidePluginAutoCompleterResult>::iterator cit;
 };
 
@@ -56,6 +59,37 @@ TidePluginAutoCompleterResult* TidePluginAutoCompleter::next()
     return &(*it);
 }
 
+static void packUInt32(std::vector<uint8_t>& packed, const uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+        packed.push_back((value >> (i * 8)) & 0xff);
+}
+
+static void packString(std::vector<uint8_t>& packed, const std::string& value)
+{
+    packUInt32(packed, value.size());
+    packed.insert(packed.end(), value.begin(), value.end());
+}
+
+const std::vector<uint8_t>& TidePluginAutoCompleter::findPacked(const std::string& hint)
+{
+    packedResults.clear();
+    packUInt32(packedResults, 0);
+    packUInt32(packedResults, completionResults.size());
+    for (const auto& result : completionResults) {
+        packUInt32(packedResults, result.kind);
+        packString(packedResults, result.type);
+        packString(packedResults, result.identifier);
+        packString(packedResults, result.detail);
+    }
+
+    const uint32_t size = packedResults.size();
+    for (int i = 0; i < 4; i++)
+        packedResults[i] = (size >> (i * 8)) & 0xff;
+
+    return packedResults;
+}
+
 TidePluginFeatures tide_plugin_features()
 {
     return TidePluginFeatures::IDEAutoComplete;
@@ -71,6 +105,13 @@ const char* tide_plugin_description()
     return "Showcasing plugin integration into Tide";
 }
 
+const TidePluginBudget* tide_plugin_budget()
+{
+    // Completion has to keep up with typing, anything slower is of no use
+    static const TidePluginBudget budget = { 0, 0, 200 };
+    return &budget;
+}
+
 TidePluginInterface tide_plugin_get_interface(const TidePluginFeatures feature)
 {
     switch (feature) {
@@ -147,4 +188,15 @@ const char* tide_plugin_autocompletorresult_detail(TideAutoCompleterResult resul
     return res->detail.c_str();
 }
 
+const void* tide_plugin_autocompletor_find_packed(TideAutoCompleter completer,
+                                                  const char* hint)
+{
+    auto autoCompleter = static_cast<TidePluginAutoCompleter*>(completer);
+    if (!autoCompleter)
+        return nullptr;
+
+    const auto& packed = autoCompleter->findPacked(std::string(hint));
+    return packed.data();
+}
+
 }
@@ -35,12 +35,32 @@ typedef void* TideAutoCompleter;
 // Plugins define publicly available functions
 #define PUBLIC __attribute__((visibility("default")))
 
+// Threading
+// Calls into the same feature interface are serialized: a setup, find and next sequence
+// of the AutoCompleter runs without other AutoCompleter calls in between.
+// Plugins with a shared memory (the wasm32-wasi-threads target) may additionally be
+// called from several threads at once, each on a stack of its own. Calls into different
+// features can overlap then, so state shared between features needs locking.
+// All other plugins are called one call at a time.
+// The entry points above must not modify any state.
+// A trap or an overrun time budget ends every call running in the plugin at that moment.
+
 // Main entry points
 TidePluginFeatures PUBLIC tide_plugin_features();
 const char* PUBLIC tide_plugin_name();
 const char* PUBLIC tide_plugin_description();
 TidePluginInterface PUBLIC tide_plugin_get_interface(const TidePluginFeatures feature);
 
+// Resources the plugin gets, optional. Fields left at zero keep the host's defaults
+// of 64KB stack, 64KB heap and 500ms per call, larger requests are capped by the host.
+// A call running past timeoutMs is terminated and the plugin gets instantiated anew.
+struct TidePluginBudget {
+    unsigned int stackSize;
+    unsigned int heapSize;
+    unsigned int timeoutMs;
+};
+const TidePluginBudget* PUBLIC tide_plugin_budget();
+
 // AutoCompleter interface
 bool PUBLIC tide_plugin_autocompletor_setup(TideAutoCompleter completer,
                                             const char* contents);
@@ -53,6 +73,26 @@ const char* PUBLIC tide_plugin_autocompletorresult_type(TideAutoCompleterResult
 const char* PUBLIC tide_plugin_autocompletorresult_identifier(TideAutoCompleterResult result);
 const char* PUBLIC tide_plugin_autocompletorresult_detail(TideAutoCompleterResult result);
 
+// AutoCompleter interface, version 2
+// Hands over all results for a hint at once instead of one call per field and result.
+// Optional: the host prefers it when exported and falls back to the functions above otherwise.
+//
+// Returns the address of a buffer in the plugin's linear memory, or NULL for no results.
+// The buffer is owned by the plugin and has to stay valid until the next call into it.
+// All integers are uint32_t in little-endian, strings are UTF-8 and not NUL terminated:
+//
+//   size                  total size of the buffer in bytes, including this field
+//   count                 number of results
+//   count times:
+//     kind                an AutoCompletorKind
+//     length, bytes       type
+//     length, bytes       identifier
+//     length, bytes       detail
+#define TIDE_PLUGIN_AUTOCOMPLETOR_PACKED_HEADER_SIZE 8
+
+const void* PUBLIC tide_plugin_autocompletor_find_packed(TideAutoCompleter completer,
+                                                         const char* hint);
+
 #ifdef __cplusplus
 }
 #endif
@@ -5,17 +5,88 @@
 #include <QStandardPaths>
 #include <QTimer>
 #include <QMutexLocker>
+#include <QtEndian>
 
 AutoCompleter::AutoCompleter(QObject *parent)
-    : QObject{parent}, clang{nullptr}, m_pluginManager{nullptr}
+    : QObject{parent}, m_generation{0}, m_decls{this}, m_pluginManager{nullptr},
+    m_typeFilter{Unspecified}, m_line{0}, m_column{0}, m_clang{nullptr}, m_index{nullptr}
 {
-    QObject::connect(&m_thread, &QThread::started, this, &AutoCompleter::run, Qt::DirectConnection);
+    m_pool.setMaxThreadCount(qBound(1, QThread::idealThreadCount(), MaxWorkers));
+
+    m_debounce.setSingleShot(true);
+    m_debounce.setInterval(DebounceMs);
+    QObject::connect(&m_debounce, &QTimer::timeout, this, &AutoCompleter::dispatch);
 }
 
 AutoCompleter::~AutoCompleter()
 {
-    m_thread.terminate();
-    m_thread.wait();
+    // Let running workers bail out at their next check, then wait for them
+    ++m_generation;
+    m_debounce.stop();
+    m_pool.clear();
+    m_pool.waitForDone();
+
+    m_units.clear();
+    if (m_clang) {
+        if (m_index) {
+            m_clang->disposeIndex(m_index);
+            m_index = nullptr;
+        }
+        delete m_clang;
+        m_clang = nullptr;
+    }
+}
+
+AutoCompleter::CachedUnit::~CachedUnit()
+{
+    if (unit) {
+        clang->disposeTranslationUnit(unit);
+    }
+}
+
+QSharedPointer<AutoCompleter::CachedUnit> AutoCompleter::cachedUnit(const QString& sourceFile)
+{
+    QMutexLocker<QMutex> locker(&m_unitsMutex);
+    auto cached = m_units.value(sourceFile);
+    if (!cached) {
+        cached.reset(new CachedUnit);
+        cached->clang = m_clang;
+        cached->unit = nullptr;
+        m_units.insert(sourceFile, cached);
+    }
+    return cached;
+}
+
+CXTranslationUnit AutoCompleter::translationUnit(CachedUnit& cached, const QString& sourceFile, const QByteArrayList& args,
+                                                 std::vector<CXUnsavedFile>& unsavedFiles)
+{
+    if (cached.unit) {
+        if (cached.args == args) {
+            const auto options = m_clang->defaultReparseOptions(cached.unit);
+            if (m_clang->reparseTranslationUnit(cached.unit, unsavedFiles.size(), unsavedFiles.data(), options) == 0) {
+                return cached.unit;
+            }
+            qWarning() << "Failed to reparse" << sourceFile << ", parsing from scratch";
+        }
+
+        // Either the flags changed or the unit is unusable after a failed reparse
+        m_clang->disposeTranslationUnit(cached.unit);
+        cached.unit = nullptr;
+    }
+
+    std::vector<const char*> argv;
+    for (const auto& arg : args) {
+        argv.push_back(arg.data());
+    }
+
+    const unsigned options = CXTranslationUnit_PrecompiledPreamble |
+                             CXTranslationUnit_CacheCompletionResults;
+    cached.unit = m_clang->parseTranslationUnit(m_index, sourceFile.toUtf8().data(),
+                                                argv.data(), argv.size(),
+                                                unsavedFiles.data(), unsavedFiles.size(),
+                                                options);
+    cached.args = args;
+    return cached.unit;
 }
 
 QStringList AutoCompleter::createHints(const QString& hint)
@@ -66,6 +137,7 @@ inline static AutoCompleter::CompletionKind getAutoCompleterKind(const CXCursorK
     case CXCursor_UnionDecl:
         return AutoCompleter::CompletionKind::Union;
     case CXCursor_ClassDecl:
+    case CXCursor_ClassTemplate:
         return AutoCompleter::CompletionKind::Class;
     case CXCursor_EnumDecl:
         return AutoCompleter::CompletionKind::Enum;
@@ -74,6 +146,7 @@ inline static AutoCompleter::CompletionKind getAutoCompleterKind(const CXCursorK
     case CXCursor_EnumConstantDecl:
         return AutoCompleter::CompletionKind::Enum;
     case CXCursor_FunctionDecl:
+    case CXCursor_FunctionTemplate:
         return AutoCompleter::CompletionKind::Function;
     case CXCursor_VarDecl:
         return AutoCompleter::CompletionKind::Variable;
@@ -86,247 +159,391 @@ inline static AutoCompleter::CompletionKind getAutoCompleterKind(const CXCursorK
     }
 }
 
-void AutoCompleter::run()
+bool AutoCompleter::completeAt(Job& job, CXTranslationUnit unit, const QString& sourceFile,
+                               std::vector<CXUnsavedFile>& unsavedFiles)
+{
+    // No cursor context, e.g. when listing the whole project for breakpoints
+    if (job.request->line <= 0 || job.request->column <= 0)
+        return false;
+
+    CXCodeCompleteResults* results = job.clang->codeCompleteAt(unit, sourceFile.toUtf8().constData(),
+                                                               job.request->line, job.request->column,
+                                                               unsavedFiles.data(), unsavedFiles.size(),
+                                                               job.clang->defaultCodeCompleteOptions());
+    if (!results)
+        return false;
+
+    if (results->NumResults == 0) {
+        job.clang->disposeCodeCompleteResults(results);
+        return false;
+    }
+
+    for (unsigned i = 0; i < results->NumResults && !cancelled(job); i++) {
+        const CXCompletionResult& result = results->Results[i];
+        const CXCompletionString completion = result.CompletionString;
+
+        const auto availability = job.clang->getCompletionAvailability(completion);
+        if (availability == CXAvailability_NotAvailable ||
+            availability == CXAvailability_NotAccessible)
+            continue;
+
+        QString prefix;
+        QString name;
+        const unsigned chunks = job.clang->getNumCompletionChunks(completion);
+        for (unsigned chunk = 0; chunk < chunks; chunk++) {
+            const auto chunkKind = job.clang->getCompletionChunkKind(completion, chunk);
+            if (chunkKind != CXCompletionChunk_TypedText &&
+                chunkKind != CXCompletionChunk_ResultType)
+                continue;
+
+            CXString text = job.clang->getCompletionChunkText(completion, chunk);
+            if (chunkKind == CXCompletionChunk_TypedText)
+                name = QString::fromUtf8(job.clang->getCString(text));
+            else
+                prefix = QString::fromUtf8(job.clang->getCString(text));
+            job.clang->disposeString(text);
+        }
+
+        if (!matchesHints(job, prefix, name, QString()))
+            continue;
+
+        foundKind(job, getAutoCompleterKind(result.CursorKind), prefix, name, QString(),
+                  job.clang->getCompletionPriority(completion));
+    }
+
+    job.clang->disposeCodeCompleteResults(results);
+    return true;
+}
+
+bool AutoCompleter::cancelled(const Job& job) const
+{
+    return job.request->generation != m_generation.load();
+}
+
+void AutoCompleter::dispatch()
 {
-    // Preparations
-    ClangWrapper clang;
+    if (!m_clang) {
+        m_clang = new ClangWrapper();
+    }
+
+    if (!m_index) {
+        m_index = m_clang->createIndex(0, 0);
+    }
+
+    QSharedPointer<Request> request(new Request);
+    request->generation = m_generation.load();
+    request->sourceFiles = m_sourceFiles;
+    request->hint = m_hint;
+    request->referenceHints = createHints(m_hint.toLower());
+    request->typeFilter = m_typeFilter;
+    request->line = m_line;
+    request->column = m_column;
+
+    request->args = { "-x", "c++", "-I." };
+    request->args << QStringLiteral("--sysroot=%1").arg(this->m_sysroot).toUtf8();
+    request->args << QStringLiteral("-I%1/include").arg(this->m_sysroot).toUtf8();
+    for (const auto& tmpArg : m_includePaths) {
+        request->args << QStringLiteral("-I%1").arg(tmpArg).toUtf8();
+    }
+
+    // Only hand over buffers of files we're about to parse, anything else may be stale
+    for (const auto& sourceFile : request->sourceFiles) {
+        if (!m_unsavedFiles.contains(sourceFile))
+            continue;
+        request->unsavedPaths << sourceFile.toUtf8();
+        request->unsavedBuffers << m_unsavedFiles.value(sourceFile);
+    }
+
+    // Drop units of files that are not part of the request anymore,
+    // a worker still holding one disposes it once it is done.
     {
-        QMutexLocker<QMutex> locker(&clangMutex);
-        this->clang = &clang;
+        QMutexLocker<QMutex> locker(&m_unitsMutex);
+        for (auto it = m_units.begin(); it != m_units.end();) {
+            if (request->sourceFiles.contains(it.key()))
+                ++it;
+            else
+                it = m_units.erase(it);
+        }
     }
 
-    m_declsInProgress.clear();
+    // Results of the previous request stay visible until the first worker reports back
+    m_results.reset();
 
-    // First from the associated plugins
     if (m_pluginManager) {
-        auto plugins = m_pluginManager->pluginRefs();
-        for (auto& plugin : plugins) {
-            if (!plugin->isValid()) {
-                qDebug() << "Plugin is invalid";
-                continue;
-            }
+        startJob(request, QString());
+    }
+
+    for (const auto& sourceFile : request->sourceFiles) {
+        startJob(request, sourceFile);
+    }
+}
+
+void AutoCompleter::startJob(const QSharedPointer<const Request>& request, const QString& sourceFile)
+{
+    m_pool.start([=]() {
+        Job job;
+        job.completer = this;
+        job.request = request;
+        job.clang = m_clang;
+        job.store.reset(new CompletionStore);
+        job.rootCursor = m_clang->getNullCursor();
+        job.deepestParent = m_clang->getNullCursor();
+
+        if (cancelled(job))
+            return;
+
+        if (sourceFile.isEmpty())
+            runPlugins(job);
+        else
+            runClang(job, sourceFile);
+
+        if (cancelled(job))
+            return;
+
+        publish(request->generation, job.store);
+    });
+}
+
+void AutoCompleter::publish(const quint64 generation, QSharedPointer<CompletionStore> store)
+{
+    // The model belongs to the GUI thread, merge results over there
+    QMetaObject::invokeMethod(this, [=]() {
+        if (generation != m_generation.load())
+            return;
+
+        QSharedPointer<CompletionStore> merged(m_results ? new CompletionStore(*m_results) : new CompletionStore);
+        merged->merge(*store);
+        merged->finalize();
+        m_results = merged;
+
+        this->m_decls.setStore(merged);
+        emit declsChanged();
+    }, Qt::QueuedConnection);
+}
+
+void AutoCompleter::runPlugins(Job& job)
+{
+    auto plugins = m_pluginManager->pluginRefs();
+    for (auto& plugin : plugins) {
+        if (cancelled(job))
+            return;
+
+        // Features are known without instantiating the plugin, isValid() instantiates
+        if (!(plugin->features() & WasmLoadable::IDEAutoComplete)) {
+            qDebug() << "Not a AutoComplete plugin";
+            continue;
+        }
+
+        if (!plugin->isValid()) {
+            qDebug() << "Plugin is invalid";
+            continue;
+        }
+
+        const auto interface = plugin->interface(WasmLoadable::IDEAutoComplete);
+        if (interface == 0) {
+            qDebug() << "No interface returned";
+            continue;
+        }
+
+        const auto loadable = plugin->loadable();
+        WasmLoadable::Session session(*loadable, WasmLoadable::IDEAutoComplete);
 
-            if (!(plugin->features() & WasmLoadable::IDEAutoComplete)) {
-                qDebug() << "Not a AutoComplete plugin";
+        // Plugins built against the v2 API hand over all results in one call
+        const bool packed = loadable->has_export(WasmLoadable::AutoCompletorFindPacked);
+
+        for (const auto& sourceFile : job.request->sourceFiles) {
+            char * buffer = NULL;
+            const auto& hint = job.request->hint;
+
+            QFile source(sourceFile);
+            if (!source.open(QFile::ReadOnly)) {
                 continue;
             }
 
-            const auto interface = plugin->interface(WasmLoadable::IDEAutoComplete);
-            if (interface == 0) {
-                qDebug() << "No interface returned";
-                continue;
+            QByteArray contents = source.readAll();
+
+            {
+                uint32_t buffer_for_wasm = loadable->make_buffer(contents.length() + 1, (void**)&buffer);
+                if (buffer_for_wasm == 0)
+                    continue;
+
+                strncpy(buffer, contents.toStdString().c_str(), hint.length());
+                buffer[hint.length()] = '\0';
+
+                loadable->call_export(WasmLoadable::AutoCompletorSetup, { interface, (int32_t)buffer_for_wasm });
+                loadable->free_buffer(buffer_for_wasm);
             }
 
-            for (const auto& sourceFile : this->sourceFiles) {
-                char * buffer = NULL;
+            {
+                uint32_t buffer_for_wasm = loadable->make_buffer(hint.length() + 1, (void**)&buffer);
+                if (buffer_for_wasm == 0)
+                    continue;
+
+                strncpy(buffer, hint.toStdString().c_str(), hint.length());
+                buffer[hint.length()] = '\0';
+
+                if (packed) {
+                    const auto found = loadable->call_export(WasmLoadable::AutoCompletorFindPacked,
+                                                             { interface, (int32_t)buffer_for_wasm });
+                    loadable->free_buffer(buffer_for_wasm);
 
-                QFile source(sourceFile);
-                if (!source.open(QFile::ReadOnly)) {
+                    if (found.of.i32)
+                        readPackedResults(job, *loadable, (uint32_t)found.of.i32);
                     continue;
                 }
 
-                QByteArray contents = source.readAll();
-
-                {
-                    uint32_t buffer_for_wasm = plugin->loadable()->make_buffer(contents.length() + 1, (void**)&buffer);
-                    if (buffer_for_wasm == 0)
-                        continue;
-
-                    strncpy(buffer, contents.toStdString().c_str(), hint.length());
-                    buffer[hint.length()] = '\0';
-
-                    std::vector<wasm_val_t> setupArgs = {
-                        {
-                            .kind = WASM_I32,
-                            .of {
-                                .i32 = interface
-                            }
-                        },{
-                            .kind = WASM_I32,
-                            .of {
-                                .i32 = (int32_t)buffer_for_wasm
-                            }
-                        }
-                    };
-                    const auto setup = plugin->loadable()->call_wasm_function("tide_plugin_autocompletor_setup", setupArgs);
-                    plugin->loadable()->free_buffer(buffer_for_wasm);
-                }
+                auto finder = loadable->call_export(WasmLoadable::AutoCompletorFind, { interface, (int32_t)buffer_for_wasm });
+                loadable->free_buffer(buffer_for_wasm);
 
-                {
-                    uint32_t buffer_for_wasm = plugin->loadable()->make_buffer(hint.length() + 1, (void**)&buffer);
-                    if (buffer_for_wasm == 0)
-                        continue;
-
-                    strncpy(buffer, hint.toStdString().c_str(), hint.length());
-                    buffer[hint.length()] = '\0';
-
-                    std::vector<wasm_val_t> args = {
-                        {
-                            .kind = WASM_I32,
-                            .of {
-                                .i32 = interface
-                            }
-                        },
-                        {
-                            .kind = WASM_I32,
-                            .of {
-                                .i32 = (int32_t)buffer_for_wasm
-                            }
-                        }
-                    };
-                    auto finder = plugin->loadable()->call_wasm_function("tide_plugin_autocompletor_find", args);
-                    plugin->loadable()->free_buffer(buffer_for_wasm);
-
-                    if (!finder.of.i32)
-                        continue;
-
-                    do {
-                        std::vector<wasm_val_t> typeArgs = {
-                            {
-                                .kind = WASM_I32,
-                                .of {
-                                    .i32 = finder.of.i32
-                                }
-                            }
-                        };
-                        const auto typeRet = plugin->loadable()->call_wasm_function("tide_plugin_autocompletorresult_type", typeArgs);
-                        const auto prefix = QString::fromUtf8(plugin->loadable()->wasm_memory<char*>(typeRet.of.i32));
-
-                        std::vector<wasm_val_t> idArgs = {
-                            {
-                                .kind = WASM_I32,
-                                .of {
-                                    .i32 = finder.of.i32
-                                }
-                            }
-                        };
-                        const auto idRet = plugin->loadable()->call_wasm_function("tide_plugin_autocompletorresult_identifier", idArgs);
-                        const auto id = QString::fromUtf8(plugin->loadable()->wasm_memory<char*>(idRet.of.i32));
-
-                        std::vector<wasm_val_t> detailArgs = {
-                            {
-                                .kind = WASM_I32,
-                                .of {
-                                    .i32 = finder.of.i32
-                                }
-                            }
-                        };
-                        const auto detailRet = plugin->loadable()->call_wasm_function("tide_plugin_autocompletorresult_detail", detailArgs);
-                        const auto detail = QString::fromUtf8(plugin->loadable()->wasm_memory<char*>(detailRet.of.i32));
-
-                        std::vector<wasm_val_t> kindArgs = {
-                            {
-                                .kind = WASM_I32,
-                                .of {
-                                    .i32 = finder.of.i32
-                                }
-                            }
-                        };
-                        const auto kindRet = plugin->loadable()->call_wasm_function("tide_plugin_autocompletorresult_kind", kindArgs);
-                        const auto kind = static_cast<CompletionKind>(kindRet.of.i32);
-
-                        foundKind(kind, prefix, id, detail);
-
-                        std::vector<wasm_val_t> nextArgs = {
-                            {
-                                .kind = WASM_I32,
-                                .of {
-                                    .i32 = interface
-                                }
-                            }
-                        };
-                        const auto next = plugin->loadable()->call_wasm_function("tide_plugin_autocompletor_next", nextArgs);
-                        if (next.of.i32 == finder.of.i32) {
-                            qWarning() << "No new autocompletion result fetched, breaking loop";
-                            break;
-                        } else {
-                            finder = next;
-                        }
-                    } while (finder.of.i32 != 0);
-                }
+                if (!finder.of.i32)
+                    continue;
+
+                do {
+                    const auto result = finder.of.i32;
+
+                    const auto typeRet = loadable->call_export(WasmLoadable::AutoCompletorResultType, { result });
+                    const auto prefix = QString::fromUtf8(loadable->wasm_memory<char*>(typeRet.of.i32));
+
+                    const auto idRet = loadable->call_export(WasmLoadable::AutoCompletorResultIdentifier, { result });
+                    const auto id = QString::fromUtf8(loadable->wasm_memory<char*>(idRet.of.i32));
+
+                    const auto detailRet = loadable->call_export(WasmLoadable::AutoCompletorResultDetail, { result });
+                    const auto detail = QString::fromUtf8(loadable->wasm_memory<char*>(detailRet.of.i32));
+
+                    const auto kindRet = loadable->call_export(WasmLoadable::AutoCompletorResultKind, { result });
+                    const auto kind = static_cast<CompletionKind>(kindRet.of.i32);
+
+                    foundKind(job, kind, prefix, id, detail);
+
+                    const auto next = loadable->call_export(WasmLoadable::AutoCompletorNext, { interface });
+                    if (next.of.i32 == finder.of.i32) {
+                        qWarning() << "No new autocompletion result fetched, breaking loop";
+                        break;
+                    } else {
+                        finder = next;
+                    }
+                } while (finder.of.i32 != 0 && !cancelled(job));
             }
         }
     }
+}
 
-    // Then using Clang
-    for (const auto& sourceFile : this->sourceFiles) {
-        CXIndex index = this->clang->createIndex(0, 0);
+// See plugins/include/tideplugin.h for the layout. Everything is read
+// from the plugin's linear memory, so each field is checked against the buffer size.
+void AutoCompleter::readPackedResults(Job& job, WasmLoadable& loadable, const uint32_t addr)
+{
+    const quint32 headerSize = 8;
+    if (!loadable.validate_buffer(addr, headerSize)) {
+        qWarning() << "Packed autocompletion results out of bounds";
+        return;
+    }
 
-        QByteArrayList tmpArgs = {
-            QStringLiteral("--sysroot=%1").arg(this->m_sysroot).toUtf8()
-        };
+    const uchar* data = loadable.wasm_memory<const uchar*>(addr);
+    const quint32 size = qFromLittleEndian<quint32>(data);
+    if (size < headerSize || !loadable.validate_buffer(addr, size)) {
+        qWarning() << "Packed autocompletion results out of bounds";
+        return;
+    }
 
-        tmpArgs << QStringLiteral("-I%1/include").arg(this->m_sysroot).toUtf8();
-        for (const auto& tmpArg : m_includePaths) {
-            tmpArgs << QStringLiteral("-I%1").arg(tmpArg).toUtf8();
+    const quint32 count = qFromLittleEndian<quint32>(data + 4);
+    const uchar* const end = data + size;
+    const uchar* it = data + headerSize;
+
+    const auto readUInt32 = [&](quint32& value) {
+        if (end - it < 4)
+            return false;
+        value = qFromLittleEndian<quint32>(it);
+        it += 4;
+        return true;
+    };
+
+    const auto readString = [&](QString& value) {
+        quint32 length = 0;
+        if (!readUInt32(length) || (quint32)(end - it) < length)
+            return false;
+        value = QString::fromUtf8(reinterpret_cast<const char*>(it), length);
+        it += length;
+        return true;
+    };
+
+    for (quint32 i = 0; i < count && !cancelled(job); i++) {
+        quint32 kind = 0;
+        QString prefix;
+        QString id;
+        QString detail;
+        if (!readUInt32(kind) || !readString(prefix) || !readString(id) || !readString(detail)) {
+            qWarning() << "Packed autocompletion results truncated after" << i << "of" << count;
+            return;
         }
 
-        std::vector<const char*> args = { "-x", "c++", "-I." };
-        for (const auto& path : tmpArgs) {
-            args.push_back(path.data());
-        }
+        foundKind(job, static_cast<CompletionKind>(kind), prefix, id, detail);
+    }
+}
 
-        CXTranslationUnit unit = this->clang->createTranslationUnitFromSourceFile(index, sourceFile.toUtf8().data(), args.size(), args.data(), 0, nullptr);
+void AutoCompleter::runClang(Job& job, const QString& sourceFile)
+{
+    std::vector<CXUnsavedFile> unsavedFiles;
+    for (int i = 0; i < job.request->unsavedPaths.size(); i++) {
+        unsavedFiles.push_back({ job.request->unsavedPaths[i].constData(), job.request->unsavedBuffers[i].constData(),
+                                 (unsigned long)job.request->unsavedBuffers[i].size() });
+    }
 
-        if (unit) {
-            this->rootCursor = this->clang->getTranslationUnitCursor(unit);
-            this->deepestParent = this->clang->getNullCursor();
+    auto cached = cachedUnit(sourceFile);
+    QMutexLocker<QMutex> locker(&cached->mutex);
+
+    // A newer request might have come in while waiting for the unit
+    if (cancelled(job))
+        return;
 
-            this->clang->visitChildren(rootCursor, [](CXCursor c, CXCursor parent, CXClientData client_data)
-                {
-                    AutoCompleter* thiz = reinterpret_cast<AutoCompleter*>(client_data);
-                    CXSourceRange cursorRange = thiz->clang->getCursorExtent(c);
-                    auto ret = CXChildVisit_Recurse;
+    CXTranslationUnit unit = translationUnit(*cached, sourceFile, job.request->args, unsavedFiles);
+    if (!unit || cancelled(job))
+        return;
 
-                    CXFile file;
-                    unsigned start_line, start_column, start_offset;
-                    unsigned end_line, end_column, end_offset;
+    // Scope-aware results at the cursor, walking the whole AST is the fallback
+    if (completeAt(job, unit, sourceFile, unsavedFiles))
+        return;
 
-                    thiz->clang->getExpansionLocation(thiz->clang->getRangeStart(cursorRange), &file, &start_line, &start_column, &start_offset);
-                    thiz->clang->getExpansionLocation(thiz->clang->getRangeEnd(cursorRange), &file, &end_line, &end_column, &end_offset);
+    job.rootCursor = job.clang->getTranslationUnitCursor(unit);
+    job.deepestParent = job.clang->getNullCursor();
 
-                    // Recurse through the tree until we find the current line, store the tailAnchor and break.
-                    if (thiz->clang->Cursor_isNull(thiz->deepestParent)) {
-                        if (thiz->line >= start_line && thiz->line <= end_line) {
-                            thiz->deepestParent = c;
-                        }
-                    }
+    job.clang->visitChildren(job.rootCursor, [](CXCursor c, CXCursor parent, CXClientData client_data)
+        {
+            Job* thiz = reinterpret_cast<Job*>(client_data);
+            if (thiz->completer->cancelled(*thiz))
+                return CXChildVisit_Break;
 
-                    if (!thiz->clang->Cursor_isNull(thiz->deepestParent)) {
-                        ret = CXChildVisit_Continue;
-                    }
+            CXSourceRange cursorRange = thiz->clang->getCursorExtent(c);
+            auto ret = CXChildVisit_Recurse;
 
-                    CXCursor lexicalParent = thiz->clang->getCursorLexicalParent(c);
-                    thiz->addDecl(c, lexicalParent, thiz->clang);
+            CXFile file;
+            unsigned start_line, start_column, start_offset;
+            unsigned end_line, end_column, end_offset;
 
-                    return ret;
-                }, this);
+            thiz->clang->getExpansionLocation(thiz->clang->getRangeStart(cursorRange), &file, &start_line, &start_column, &start_offset);
+            thiz->clang->getExpansionLocation(thiz->clang->getRangeEnd(cursorRange), &file, &end_line, &end_column, &end_offset);
 
-            this->anchorTrail.clear();
-            this->deepestParent = this->clang->getNullCursor();
-            this->rootCursor = this->clang->getNullCursor();
-            this->clang->disposeTranslationUnit(unit);
-        }
+            // Recurse through the tree until we find the current line, store the tailAnchor and break.
+            if (thiz->clang->Cursor_isNull(thiz->deepestParent)) {
+                if (thiz->request->line >= start_line && thiz->request->line <= end_line) {
+                    thiz->deepestParent = c;
+                }
+            }
 
-        this->clang->disposeIndex(index);
-    }
+            if (!thiz->clang->Cursor_isNull(thiz->deepestParent)) {
+                ret = CXChildVisit_Continue;
+            }
 
-    {
-        QMutexLocker<QMutex> locker(&declsMutex);
-        this->m_decls = m_declsInProgress;
-        emit declsChanged();
-    }
+            CXCursor lexicalParent = thiz->clang->getCursorLexicalParent(c);
+            addDecl(*thiz, c, lexicalParent);
 
-    {
-        QMutexLocker<QMutex> locker(&clangMutex);
-        this->clang = nullptr;
-    }
+            return ret;
+        }, &job);
 }
 
-void AutoCompleter::addDecl(CXCursor c, CXCursor parent, ClangWrapper* clang)
+void AutoCompleter::addDecl(Job& job, CXCursor c, CXCursor parent)
 {
+    ClangWrapper* clang = job.clang;
     CXCursorKind kind = clang->getCursorKind(c);
-    CXCursorKind parentKind = clang->getCursorKind(parent);
 
     CXType cursorType = clang->getCursorType(c);
     CXString typeSpelling = clang->getTypeSpelling(cursorType);
@@ -334,7 +551,7 @@ void AutoCompleter::addDecl(CXCursor c, CXCursor parent, ClangWrapper* clang)
     clang->disposeString(typeSpelling);
 
     QString detail;
-    if (!clang->equalCursors(parent, this->rootCursor)) {
+    if (!clang->equalCursors(parent, job.rootCursor)) {
         CXString relationSpelling = clang->getCursorSpelling(parent);
         detail = QString::fromUtf8(clang->getCString(relationSpelling));
         clang->disposeString(relationSpelling);
@@ -346,44 +563,39 @@ void AutoCompleter::addDecl(CXCursor c, CXCursor parent, ClangWrapper* clang)
 
     CompletionKind completionKind = getAutoCompleterKind(kind);
 
-    if (this->referenceHints.length() != 0) {
-        bool hintedResults = false;
-        for (const auto& hint : this->referenceHints) {
-            if (!prefix.toLower().contains(hint) &&
-                !name.toLower().contains(hint) &&
-                !detail.toLower().contains(hint))
-                continue;
-            hintedResults = true;
-        }
-
-        if (!hintedResults)
-            return;
-    }
+    if (!matchesHints(job, prefix, name, detail))
+        return;
 
     qDebug() << "Found kind:" << prefix << name << detail;
-    foundKind(completionKind, prefix, name, detail);
+    foundKind(job, completionKind, prefix, name, detail);
 }
 
-void AutoCompleter::reloadAst(const QStringList paths, const QString hint, const CompletionKind filter, const int line, const int column)
+bool AutoCompleter::matchesHints(const Job& job, const QString& prefix, const QString& name, const QString& detail)
 {
-    {
-        QMutexLocker<QMutex> locker(&clangMutex);
-        // AST reload in progress
-        if (clang) {
-            return;
-        }
+    if (job.request->referenceHints.length() == 0)
+        return true;
+
+    for (const auto& hint : job.request->referenceHints) {
+        if (prefix.toLower().contains(hint) ||
+            name.toLower().contains(hint) ||
+            detail.toLower().contains(hint))
+            return true;
     }
+    return false;
+}
 
-    this->sourceFiles = paths;
-    this->hint = hint;
-    this->referenceHints = createHints(hint.toLower());
-    this->line = line;
-    this->column = column;
-    this->foundLine = true;
-    this->typeFilter = filter;
+void AutoCompleter::reloadAst(const QStringList paths, const QString hint, const CompletionKind filter, const int line, const int column)
+{
+    // Superseded work stops at its next cancellation check
+    ++m_generation;
+
+    this->m_sourceFiles = paths;
+    this->m_hint = hint;
+    this->m_typeFilter = filter;
+    this->m_line = line;
+    this->m_column = column;
 
-    m_thread.terminate();
-    m_thread.start();
+    m_debounce.start();
 }
 
 void AutoCompleter::setSysroot(const QString sysroot)
@@ -396,55 +608,27 @@ void AutoCompleter::setIncludePaths(const QStringList paths)
     this->m_includePaths = paths;
 }
 
-QVariantList AutoCompleter::filteredDecls(const QString str)
+void AutoCompleter::setUnsavedFile(const QString path, const QString contents)
 {
-    qDebug() << "Filter:" << str;
-    QVariantList ret;
-    QMutexLocker<QMutex> locker(&declsMutex);
-
-    for (const auto& decl : m_decls) {
-        const auto declMap = decl.toMap();
-        const auto declPrefix = declMap.value("prefix").toString();
-        const auto declName = declMap.value("name").toString();
-        const auto declKind = declMap.value("kind").value<AutoCompleter::CompletionKind>();
-        if (declName == str) {
-            ret.push_front(decl);
-        } else if (declPrefix.toLower().contains(str.toLower()) ||
-                   declName.toLower().contains(str.toLower())) {
-            ret.push_back(decl);
-        }
-    }
-    return ret;
+    this->m_unsavedFiles.insert(path, contents.toUtf8());
 }
 
-void AutoCompleter::foundKind(const CompletionKind kind, const QString prefix, const QString name, const QString detail)
+CompletionModel* AutoCompleter::decls()
+{
+    return &this->m_decls;
+}
+
+void AutoCompleter::foundKind(Job& job, const CompletionKind kind, const QString prefix, const QString name, const QString detail,
+                              const unsigned priority)
 {
     if (name.isEmpty())
         return;
 
-    if (this->typeFilter != CompletionKind::Unspecified) {
-        if (kind == CompletionKind::Unspecified || !(this->typeFilter & kind)) {
-            return;
-        }
-    }
-
-    QVariantMap decl;
-    decl.insert("prefix", prefix);
-    decl.insert("name", name);
-    decl.insert("detail", detail);
-    decl.insert("kind", kind);
-
-    for (const auto& decl : m_declsInProgress) {
-        const auto declMap = decl.toMap();
-        if (declMap.value("prefix").toString() == prefix &&
-            declMap.value("name").toString() == name) {
+    if (job.request->typeFilter != CompletionKind::Unspecified) {
+        if (kind == CompletionKind::Unspecified || !(job.request->typeFilter & kind)) {
             return;
         }
     }
 
-    if (kind != AutoCompleter::CompletionKind::Unspecified) {
-        m_declsInProgress.push_front(decl);
-    } else {
-        m_declsInProgress.push_back(decl);
-    }
+    job.store->insert(prefix, name, detail, kind, priority);
 }
@@ -4,20 +4,26 @@
 #include <QObject>
 #include <QVariantMap>
 #include <QThread>
+#include <QThreadPool>
+#include <QTimer>
 #include <QList>
 #include <QMutex>
+#include <QHash>
+#include <QSharedPointer>
 
+#include <atomic>
 #include <vector>
 
 #include "plugins/tidepluginmanager.h"
 
 #include "clangwrapper.h"
+#include "completionmodel.h"
 
 class AutoCompleter : public QObject
 {
     Q_OBJECT
 
-    Q_PROPERTY(QVariantList decls MEMBER m_decls NOTIFY declsChanged)
+    Q_PROPERTY(CompletionModel* decls READ decls NOTIFY declsChanged)
     Q_PROPERTY(TidePluginManager* pluginsManager MEMBER m_pluginManager NOTIFY pluginManagerChanged)
 
 public:
@@ -46,44 +52,100 @@ public:
         CXCursor cursor; // Compared to in the second pass as the semantic parent
     };
 
+    // Matches libclang's CCP_Declaration, used for results without a priority of their own
+    static constexpr unsigned DefaultPriority = 50;
+    // Keystrokes arriving within this window are folded into a single request
+    static constexpr int DebounceMs = 150;
+    static constexpr int MaxWorkers = 4;
+
     explicit AutoCompleter(QObject *parent = nullptr);
     ~AutoCompleter();
-    void foundKind(const CompletionKind kind, const QString prefix, const QString name, const QString detail);
-    void addDecl(CXCursor c, CXCursor parent, ClangWrapper* clang);
-
-    QMutex clangMutex;
-    QMutex declsMutex;
-    ClangWrapper* clang;
-    CXCursor rootCursor;
-    CXCursor deepestParent;
-    int line;
-    int column;
-    bool foundLine;
-    QStringList sourceFiles;
-    QList<CXCursor> anchorTrail;
-    QList<QList<CXCursor>> anchorTrails;
-    QStringList referenceHints;
-    QString hint;
-    CompletionKind typeFilter;
+    CompletionModel* decls();
 
 public slots:
     void reloadAst(const QStringList path, const QString hint, const CompletionKind filter, const int line, const int column);
     void setSysroot(const QString sysroot);
     void setIncludePaths(const QStringList paths);
-    QVariantList filteredDecls(const QString str);
+    void setUnsavedFile(const QString path, const QString contents);
 
 private:
-    void run();
-    QStringList createHints(const QString& hint);
+    // Snapshot of a reloadAst() call, shared read-only between its workers
+    struct Request {
+        quint64 generation;
+        QStringList sourceFiles;
+        QString hint;
+        QStringList referenceHints;
+        CompletionKind typeFilter;
+        int line;
+        int column;
+        QByteArrayList args;
+        QByteArrayList unsavedPaths;
+        QByteArrayList unsavedBuffers;
+    };
+
+    // State of a single worker, i.e. the plugins or one source file
+    struct Job {
+        AutoCompleter* completer;
+        QSharedPointer<const Request> request;
+        ClangWrapper* clang;
+        QSharedPointer<CompletionStore> store;
+        CXCursor rootCursor;
+        CXCursor deepestParent;
+    };
 
-    QThread m_thread;
-    QVariantList m_decls;
-    QVariantList m_declsInProgress;
+    // Only one worker may touch a translation unit at a time
+    struct CachedUnit {
+        ~CachedUnit();
+
+        QMutex mutex;
+        ClangWrapper* clang;
+        CXTranslationUnit unit;
+        QByteArrayList args;
+    };
+
+    void dispatch();
+    void startJob(const QSharedPointer<const Request>& request, const QString& sourceFile);
+    void runPlugins(Job& job);
+    void readPackedResults(Job& job, WasmLoadable& loadable, const uint32_t addr);
+    void runClang(Job& job, const QString& sourceFile);
+    void publish(const quint64 generation, QSharedPointer<CompletionStore> store);
+    bool cancelled(const Job& job) const;
+    QStringList createHints(const QString& hint);
+    QSharedPointer<CachedUnit> cachedUnit(const QString& sourceFile);
+    CXTranslationUnit translationUnit(CachedUnit& cached, const QString& sourceFile, const QByteArrayList& args,
+                                      std::vector<CXUnsavedFile>& unsavedFiles);
+    bool completeAt(Job& job, CXTranslationUnit unit, const QString& sourceFile,
+                    std::vector<CXUnsavedFile>& unsavedFiles);
+
+    static void foundKind(Job& job, const CompletionKind kind, const QString prefix, const QString name, const QString detail,
+                          const unsigned priority = DefaultPriority);
+    static void addDecl(Job& job, CXCursor c, CXCursor parent);
+    static bool matchesHints(const Job& job, const QString& prefix, const QString& name, const QString& detail);
+
+    QThreadPool m_pool;
+    QTimer m_debounce;
+    std::atomic<quint64> m_generation;
+    CompletionModel m_decls;
+    QSharedPointer<CompletionStore> m_results;
     QString m_sysroot;
     QStringList m_includePaths;
     QList<CompletionHint> m_anchorDecls;
     TidePluginManager* m_pluginManager;
 
+    // Pending reloadAst() arguments, picked up once the debounce timer fires
+    QStringList m_sourceFiles;
+    QString m_hint;
+    CompletionKind m_typeFilter;
+    int m_line;
+    int m_column;
+
+    // Kept alive across runs so that libclang can reuse the preamble
+    ClangWrapper* m_clang;
+    CXIndex m_index;
+    QMutex m_unitsMutex;
+    QHash<QString, QSharedPointer<CachedUnit>> m_units;
+    QHash<QString, QByteArray> m_unsavedFiles;
+
 signals:
     void declsChanged();
     void pluginManagerChanged();
@@ -0,0 +1,191 @@
+#include "completionmodel.h"
+
+#include <algorithm>
+
+bool CompletionStore::insert(const QString& prefix, const QString& name, const QString& detail,
+                             const int kind, const unsigned priority)
+{
+    const auto key = qMakePair(prefix, name);
+    if (m_keys.contains(key))
+        return false;
+
+    m_keys.insert(key);
+    m_entries.push_back({ prefix, name, detail, kind, priority, prefix.toLower(), name.toLower() });
+    return true;
+}
+
+void CompletionStore::merge(const CompletionStore& other)
+{
+    for (const auto& entry : other.m_entries) {
+        insert(entry.prefix, entry.name, entry.detail, entry.kind, entry.priority);
+    }
+}
+
+void CompletionStore::finalize()
+{
+    // Lower priority values are the more likely candidates, unknown kinds go last
+    std::stable_sort(m_entries.begin(), m_entries.end(), [](const CompletionEntry& a, const CompletionEntry& b) {
+        if (a.priority != b.priority)
+            return a.priority < b.priority;
+        return (a.kind != 0) && (b.kind == 0);
+    });
+
+    m_ngrams.clear();
+    for (int i = 0; i < m_entries.size(); i++) {
+        indexNGrams(m_entries[i].lowerPrefix, i);
+        indexNGrams(m_entries[i].lowerName, i);
+    }
+}
+
+void CompletionStore::indexNGrams(const QString& key, const int index)
+{
+    for (int i = 0; i + NGramSize <= key.size(); i++) {
+        auto& postings = m_ngrams[key.mid(i, NGramSize)];
+        // Entries are indexed in order, so duplicates can only be at the back
+        if (postings.isEmpty() || postings.last() != index)
+            postings.push_back(index);
+    }
+}
+
+QVector<int> CompletionStore::filter(const QString& str) const
+{
+    QVector<int> ret;
+    const QString needle = str.toLower();
+
+    if (needle.isEmpty()) {
+        ret.reserve(m_entries.size());
+        for (int i = 0; i < m_entries.size(); i++)
+            ret.push_back(i);
+        return ret;
+    }
+
+    // Narrow down to the smallest posting list, short needles scan everything
+    const QVector<int>* candidates = nullptr;
+    if (needle.size() >= NGramSize) {
+        for (int i = 0; i + NGramSize <= needle.size(); i++) {
+            const auto it = m_ngrams.constFind(needle.mid(i, NGramSize));
+            if (it == m_ngrams.constEnd())
+                return ret;
+            if (!candidates || it->size() < candidates->size())
+                candidates = &it.value();
+        }
+    }
+
+    QVector<int> exact;
+    const auto match = [&](const int index) {
+        const auto& entry = m_entries.at(index);
+        if (entry.name == str) {
+            exact.push_back(index);
+        } else if (entry.lowerPrefix.contains(needle) || entry.lowerName.contains(needle)) {
+            ret.push_back(index);
+        }
+    };
+
+    if (candidates) {
+        for (const auto index : *candidates)
+            match(index);
+    } else {
+        for (int i = 0; i < m_entries.size(); i++)
+            match(i);
+    }
+
+    return exact + ret;
+}
+
+CompletionModel::CompletionModel(QObject *parent)
+    : QAbstractListModel{parent}
+{
+}
+
+int CompletionModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid())
+        return 0;
+    return m_rows.size();
+}
+
+QVariant CompletionModel::data(const QModelIndex &index, int role) const
+{
+    if (!m_store || !index.isValid() || index.row() >= m_rows.size())
+        return QVariant();
+
+    const auto& entry = m_store->at(m_rows.at(index.row()));
+    switch (role) {
+    case Qt::DisplayRole:
+    case NameRole:
+        return entry.name;
+    case PrefixRole:
+        return entry.prefix;
+    case DetailRole:
+        return entry.detail;
+    case KindRole:
+        return entry.kind;
+    case PriorityRole:
+        return entry.priority;
+    default:
+        return QVariant();
+    }
+}
+
+QHash<int, QByteArray> CompletionModel::roleNames() const
+{
+    return {
+        { PrefixRole, "prefix" },
+        { NameRole, "name" },
+        { DetailRole, "detail" },
+        { KindRole, "kind" },
+        { PriorityRole, "priority" }
+    };
+}
+
+void CompletionModel::setStore(QSharedPointer<const CompletionStore> store)
+{
+    this->m_store = store;
+    refilter();
+}
+
+QString CompletionModel::filter() const
+{
+    return this->m_filter;
+}
+
+void CompletionModel::setFilter(const QString filter)
+{
+    if (this->m_filter == filter)
+        return;
+
+    this->m_filter = filter;
+    refilter();
+    emit filterChanged();
+}
+
+int CompletionModel::count() const
+{
+    return m_rows.size();
+}
+
+QVariantMap CompletionModel::get(const int row) const
+{
+    QVariantMap ret;
+    if (!m_store || row < 0 || row >= m_rows.size())
+        return ret;
+
+    const auto& entry = m_store->at(m_rows.at(row));
+    ret.insert("prefix", entry.prefix);
+    ret.insert("name", entry.name);
+    ret.insert("detail", entry.detail);
+    ret.insert("kind", entry.kind);
+    ret.insert("priority", entry.priority);
+    return ret;
+}
+
+void CompletionModel::refilter()
+{
+    beginResetModel();
+    if (m_store)
+        m_rows = m_store->filter(m_filter);
+    else
+        m_rows.clear();
+    endResetModel();
+    emit countChanged();
+}
@@ -0,0 +1,88 @@
+#ifndef COMPLETIONMODEL_H
+#define COMPLETIONMODEL_H
+
+#include <QAbstractListModel>
+#include <QHash>
+#include <QSet>
+#include <QPair>
+#include <QSharedPointer>
+#include <QVector>
+
+struct CompletionEntry {
+    QString prefix;
+    QString name;
+    QString detail;
+    int kind;
+    unsigned priority;
+
+    // Lowercased once on insertion, filtering happens on every keystroke
+    QString lowerPrefix;
+    QString lowerName;
+};
+
+// Collects completion results on the worker thread, read-only once finalized
+class CompletionStore
+{
+public:
+    bool insert(const QString& prefix, const QString& name, const QString& detail,
+                const int kind, const unsigned priority);
+    void merge(const CompletionStore& other);
+    void finalize();
+
+    int size() const { return m_entries.size(); }
+    const CompletionEntry& at(const int index) const { return m_entries.at(index); }
+    QVector<int> filter(const QString& str) const;
+
+private:
+    static constexpr int NGramSize = 3;
+
+    void indexNGrams(const QString& key, const int index);
+
+    QVector<CompletionEntry> m_entries;
+    QSet<QPair<QString, QString>> m_keys;
+    QHash<QString, QVector<int>> m_ngrams;
+};
+
+class CompletionModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+    Q_PROPERTY(QString filter READ filter WRITE setFilter NOTIFY filterChanged)
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+
+public:
+    enum Roles {
+        PrefixRole = Qt::UserRole + 1,
+        NameRole,
+        DetailRole,
+        KindRole,
+        PriorityRole
+    };
+
+    explicit CompletionModel(QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    void setStore(QSharedPointer<const CompletionStore> store);
+    QString filter() const;
+    void setFilter(const QString filter);
+    int count() const;
+
+public slots:
+    QVariantMap get(const int row) const;
+
+private:
+    void refilter();
+
+    QSharedPointer<const CompletionStore> m_store;
+    QVector<int> m_rows;
+    QString m_filter;
+
+signals:
+    void filterChanged();
+    void countChanged();
+};
+
+#endif // COMPLETIONMODEL_H
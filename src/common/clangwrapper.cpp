@@ -46,6 +46,16 @@ ClangWrapper::ClangWrapper()
     *(void**)(&getExpansionLocation) = dlsym(this->handle, "clang_getExpansionLocation");
     *(void**)(&getCursorReferenced) = dlsym(this->handle, "clang_getCursorReferenced");
     *(void**)(&parseTranslationUnit) = dlsym(this->handle, "clang_parseTranslationUnit");
+    *(void**)(&reparseTranslationUnit) = dlsym(this->handle, "clang_reparseTranslationUnit");
+    *(void**)(&defaultReparseOptions) = dlsym(this->handle, "clang_defaultReparseOptions");
+    *(void**)(&codeCompleteAt) = dlsym(this->handle, "clang_codeCompleteAt");
+    *(void**)(&defaultCodeCompleteOptions) = dlsym(this->handle, "clang_defaultCodeCompleteOptions");
+    *(void**)(&disposeCodeCompleteResults) = dlsym(this->handle, "clang_disposeCodeCompleteResults");
+    *(void**)(&getNumCompletionChunks) = dlsym(this->handle, "clang_getNumCompletionChunks");
+    *(void**)(&getCompletionChunkKind) = dlsym(this->handle, "clang_getCompletionChunkKind");
+    *(void**)(&getCompletionChunkText) = dlsym(this->handle, "clang_getCompletionChunkText");
+    *(void**)(&getCompletionPriority) = dlsym(this->handle, "clang_getCompletionPriority");
+    *(void**)(&getCompletionAvailability) = dlsym(this->handle, "clang_getCompletionAvailability");
 }
 
 ClangWrapper::~ClangWrapper()
@@ -23,6 +23,9 @@ public:
         const char *const *command_line_args, int num_command_line_args,
         struct CXUnsavedFile *unsaved_files, unsigned num_unsaved_files,
         unsigned options);
+    int (*reparseTranslationUnit)(CXTranslationUnit, unsigned,
+                                  struct CXUnsavedFile *, unsigned);
+    unsigned (*defaultReparseOptions)(CXTranslationUnit);
     CXCursor (*getTranslationUnitCursor)(CXTranslationUnit);
     unsigned (*visitChildren)(CXCursor,
                               CXCursorVisitor,
@@ -50,6 +53,17 @@ public:
                                  unsigned *column,
                                  unsigned *offset);
     CXCursor (*getCursorReferenced)(CXCursor);
+    CXCodeCompleteResults* (*codeCompleteAt)(CXTranslationUnit, const char *,
+                                             unsigned, unsigned,
+                                             struct CXUnsavedFile *, unsigned,
+                                             unsigned);
+    unsigned (*defaultCodeCompleteOptions)(void);
+    void (*disposeCodeCompleteResults)(CXCodeCompleteResults *);
+    unsigned (*getNumCompletionChunks)(CXCompletionString);
+    enum CXCompletionChunkKind (*getCompletionChunkKind)(CXCompletionString, unsigned);
+    CXString (*getCompletionChunkText)(CXCompletionString, unsigned);
+    unsigned (*getCompletionPriority)(CXCompletionString);
+    enum CXAvailabilityKind (*getCompletionAvailability)(CXCompletionString);
 };
 
 #endif // CLANGWRAPPER_H
@@ -0,0 +1,85 @@
+#ifndef WASMMEMORYPOOL_H
+#define WASMMEMORYPOOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Arena the runtime allocates everything from when initialized with Alloc_With_Pool.
+// It is mapped once and kept across runs and runtime re-initializations, so its pages
+// stay faulted in instead of going back and forth through malloc and the kernel.
+// Nothing clears it between runs: WAMR zeroes linear memory and instance data
+// as it hands them out, so stale contents only get overwritten lazily on reuse.
+class WasmMemoryPool
+{
+public:
+    ~WasmMemoryPool()
+    {
+        unmap();
+    }
+
+    // Only to be called while no runtime is using the pool.
+    // Grows the arena if needed, a smaller request keeps the existing one.
+    bool reserve(const size_t size, const bool prefault)
+    {
+        if (m_data && m_size >= size)
+            return true;
+
+        unmap();
+
+        const size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+        const size_t mappedSize = (size + pageSize - 1) / pageSize * pageSize;
+
+        void* data = mmap(NULL, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (data == MAP_FAILED) {
+            std::cout << "Failed to map memory pool of " << mappedSize << " bytes" << std::endl;
+            return false;
+        }
+
+#ifdef MADV_HUGEPAGE
+        // Only a hint, transparent huge pages might be disabled altogether
+        madvise(data, mappedSize, MADV_HUGEPAGE);
+#endif
+
+        m_data = (uint8_t*)data;
+        m_size = mappedSize;
+
+        // Takes the page faults now rather than during the first runs
+        if (prefault) {
+            for (size_t offset = 0; offset < m_size; offset += pageSize)
+                m_data[offset] = 0;
+        }
+
+        std::cout << "Memory pool: " << m_size / 1024 / 1024 << "MB" << std::endl;
+        return true;
+    }
+
+    void* data() const
+    {
+        return m_data;
+    }
+
+    uint32_t size() const
+    {
+        return (uint32_t)m_size;
+    }
+
+private:
+    void unmap()
+    {
+        if (!m_data)
+            return;
+
+        munmap(m_data, m_size);
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+#endif // WASMMEMORYPOOL_H
@@ -0,0 +1,321 @@
+#ifndef WASMMODULECACHE_H
+#define WASMMODULECACHE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <wasm_export.h>
+
+#include "bh_read_file.h"
+
+// Binary a module gets loaded from. WAMR refers to it until the module is unloaded
+// and may write to it, so mapped files are mapped privately and writable.
+// Mapping keeps untouched pages backed by the file instead of a heap copy,
+// the linker replaces binaries instead of rewriting them in place.
+struct WasmModuleBuffer {
+    uint8_t* data = nullptr;
+    uint32_t size = 0;
+    bool mapped = false;
+};
+
+static inline bool wasm_module_buffer_open(const std::string& path, const bool useMmap, WasmModuleBuffer* buffer)
+{
+    if (!useMmap) {
+        buffer->mapped = false;
+        buffer->data = (uint8_t*)bh_read_file_to_buffer(path.c_str(), &buffer->size);
+        return buffer->data != nullptr;
+    }
+
+    const int file = open(path.c_str(), O_RDONLY, 0);
+    if (file == -1) {
+        printf("Read file to buffer failed: open file %s failed.\n", path.c_str());
+        return false;
+    }
+
+    struct stat stat_buf;
+    if (fstat(file, &stat_buf) != 0 || stat_buf.st_size == 0) {
+        printf("Read file to buffer failed: fstat file %s failed.\n", path.c_str());
+        close(file);
+        return false;
+    }
+
+    void* data = mmap(NULL, stat_buf.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+
+    // The mapping keeps the file referenced on its own
+    close(file);
+
+    if (data == MAP_FAILED) {
+        printf("Read file to buffer failed: mmap file %s failed.\n", path.c_str());
+        return false;
+    }
+
+    buffer->data = (uint8_t*)data;
+    buffer->size = (uint32_t)stat_buf.st_size;
+    buffer->mapped = true;
+    return true;
+}
+
+// Only to be called once the module loaded from the buffer is unloaded
+static inline void wasm_module_buffer_close(WasmModuleBuffer* buffer)
+{
+    if (!buffer->data)
+        return;
+
+    if (buffer->mapped)
+        munmap(buffer->data, buffer->size);
+    else
+        BH_FREE(buffer->data);
+
+    buffer->data = nullptr;
+    buffer->size = 0;
+}
+
+// FNV-1a, only used to tell binaries apart
+static inline uint64_t wasm_module_buffer_hash(const uint8_t* data, const uint32_t size)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (uint32_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Keeps loaded and validated modules around between runs of the same binary.
+// Entries are looked up by path, file identity and modification time first,
+// falling back to the content hash when the file has been touched without changing.
+// Only the latest build of a path is kept, older ones go once they are released.
+// Modules belong to the runtime, clear() has to be called before it is destroyed.
+class WasmModuleCache
+{
+public:
+    struct Entry {
+        ~Entry() {
+            if (module)
+                wasm_runtime_unload(module);
+            wasm_module_buffer_close(&buffer);
+        }
+
+        wasm_module_t module = nullptr;
+        WasmModuleBuffer buffer;
+        uint64_t size = 0;
+        uint64_t footprint = 0;
+        uint64_t hash = 0;
+        std::string path;
+        uint64_t inode = 0;
+        int64_t mtime = 0;
+        bool inUse = false;
+        bool stale = false;
+    };
+
+    // The capacity is counted in estimated memory of loaded modules: loadFactor times the
+    // binary's size for what the loader and compilers make of it, plus the binary
+    // itself unless it is mapped.
+    WasmModuleCache(const size_t capacity, const unsigned int loadFactor) :
+        m_capacity(capacity), m_loadFactor(loadFactor) {}
+
+    // Hands out a module for exclusive use until release() is called.
+    // A module that is still in use by another run is loaded once more, uncached.
+    // Without useCache the module is always loaded from the file and never kept.
+    std::shared_ptr<Entry> acquire(const std::string& path, const bool useMmap, const bool useCache,
+                                   char* error_buf, uint32_t error_buf_size)
+    {
+        struct stat stat_buf;
+        if (stat(path.c_str(), &stat_buf) != 0) {
+            snprintf(error_buf, error_buf_size, "Failed to stat %s", path.c_str());
+            return nullptr;
+        }
+
+        const auto mtime = modificationTime(stat_buf);
+
+        if (useCache) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto it = m_entries.begin(); it != m_entries.end(); it++) {
+                const auto& entry = *it;
+                if (entry->inUse || entry->path != path || entry->inode != (uint64_t)stat_buf.st_ino ||
+                    entry->mtime != mtime || entry->size != (uint64_t)stat_buf.st_size ||
+                    entry->buffer.mapped != useMmap)
+                    continue;
+
+                return hit(it);
+            }
+        }
+
+        auto loaded = std::make_shared<Entry>();
+        loaded->path = path;
+        loaded->inode = stat_buf.st_ino;
+        loaded->mtime = mtime;
+        if (!wasm_module_buffer_open(path, useMmap, &loaded->buffer)) {
+            snprintf(error_buf, error_buf_size, "Failed to read %s", path.c_str());
+            return nullptr;
+        }
+        loaded->size = loaded->buffer.size;
+        loaded->footprint = loaded->size * m_loadFactor + (useMmap ? 0 : loaded->size);
+
+        // Hashed before WAMR gets to modify the buffer
+        loaded->hash = wasm_module_buffer_hash(loaded->buffer.data, loaded->buffer.size);
+
+        if (useCache) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto it = m_entries.begin(); it != m_entries.end(); it++) {
+                const auto& entry = *it;
+                if (entry->inUse || entry->size != loaded->size || entry->hash != loaded->hash ||
+                    entry->buffer.mapped != useMmap)
+                    continue;
+
+                // Same contents, just remember the file as it is now
+                entry->path = loaded->path;
+                entry->inode = loaded->inode;
+                entry->mtime = loaded->mtime;
+                return hit(it);
+            }
+        }
+
+        loaded->module = wasm_runtime_load(loaded->buffer.data, loaded->buffer.size, error_buf, error_buf_size);
+        if (!loaded->module)
+            return nullptr;
+
+        loaded->inUse = true;
+        if (!useCache)
+            return loaded;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_misses++;
+        std::cout << "Module cache miss for " << path
+                  << " (hits: " << m_hits << ", misses: " << m_misses << ")" << std::endl;
+
+        dropOutdated(*loaded);
+        if (loaded->footprint <= m_capacity) {
+            m_entries.push_front(loaded);
+            m_size += loaded->footprint;
+            evict();
+        }
+        return loaded;
+    }
+
+    // Modules loaded from now on count against the new capacity too
+    void setCapacity(const size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_capacity = capacity;
+        evict();
+    }
+
+    void release(const std::shared_ptr<Entry>& entry)
+    {
+        if (!entry)
+            return;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        entry->inUse = false;
+        if (entry->stale) {
+            const auto it = std::find(m_entries.begin(), m_entries.end(), entry);
+            if (it != m_entries.end()) {
+                m_size -= entry->footprint;
+                m_entries.erase(it);
+            }
+        }
+        evict();
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.clear();
+        m_size = 0;
+    }
+
+    uint64_t hits()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_hits;
+    }
+
+    uint64_t misses()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_misses;
+    }
+
+private:
+    static int64_t modificationTime(const struct stat& stat_buf)
+    {
+#if __APPLE__
+        return (int64_t)stat_buf.st_mtimespec.tv_sec * 1000000000 + stat_buf.st_mtimespec.tv_nsec;
+#else
+        return (int64_t)stat_buf.st_mtim.tv_sec * 1000000000 + stat_buf.st_mtim.tv_nsec;
+#endif
+    }
+
+    // Called with m_mutex held, moves the entry to the front
+    std::shared_ptr<Entry> hit(std::list<std::shared_ptr<Entry>>::iterator it)
+    {
+        auto entry = *it;
+        m_entries.erase(it);
+        m_entries.push_front(entry);
+        entry->inUse = true;
+
+        m_hits++;
+        std::cout << "Module cache hit for " << entry->path
+                  << " (hits: " << m_hits << ", misses: " << m_misses << ")" << std::endl;
+        return entry;
+    }
+
+    // Called with m_mutex held. Earlier builds of the binary are never hit again,
+    // entries still in use are dropped when they are released.
+    void dropOutdated(const Entry& latest)
+    {
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            const auto& entry = *it;
+            if (entry->path != latest.path || (entry->inode == latest.inode &&
+                                               entry->mtime == latest.mtime &&
+                                               entry->size == latest.size)) {
+                it++;
+                continue;
+            }
+
+            if (entry->inUse) {
+                entry->stale = true;
+                it++;
+                continue;
+            }
+
+            m_size -= entry->footprint;
+            it = m_entries.erase(it);
+        }
+    }
+
+    // Called with m_mutex held, least recently used entries go first
+    void evict()
+    {
+        auto it = m_entries.end();
+        while (m_size > m_capacity && it != m_entries.begin()) {
+            it--;
+            if ((*it)->inUse)
+                continue;
+
+            m_size -= (*it)->footprint;
+            it = m_entries.erase(it);
+        }
+    }
+
+    std::mutex m_mutex;
+    std::list<std::shared_ptr<Entry>> m_entries;
+    size_t m_capacity;
+    const unsigned int m_loadFactor;
+    size_t m_size = 0;
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+};
+
+#endif // WASMMODULECACHE_H
@@ -0,0 +1,122 @@
+#ifndef WASMRUNMONITOR_H
+#define WASMRUNMONITOR_H
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include <wasm_export.h>
+
+#if WASM_ENABLE_THREAD_MGR != 0
+#include "thread_manager.h"
+#endif
+
+// Milliseconds passed since *since, which then moves on to now
+static inline double wasm_run_lap(std::chrono::steady_clock::time_point* since)
+{
+    const auto now = std::chrono::steady_clock::now();
+    const double ret = std::chrono::duration_cast<std::chrono::microseconds>(now - *since).count() / 1000.0;
+    *since = now;
+    return ret;
+}
+
+// Watches linear memory and guest threads of a running instance from a thread of its own.
+// It wakes rarely so as not to disturb the run it measures, and polls once more at the end:
+// memory never shrinks, so the peak and the pages grown are exact. Threads living shorter
+// than an interval can be missed in the peak thread count.
+class WasmRunMonitor
+{
+public:
+    static constexpr std::chrono::milliseconds PollInterval{50};
+
+    WasmRunMonitor(wasm_module_inst_t moduleInst, wasm_exec_env_t execEnv) :
+        m_moduleInst(moduleInst), m_execEnv(execEnv) {}
+
+    ~WasmRunMonitor()
+    {
+        stop();
+    }
+
+    void start()
+    {
+        poll();
+        m_running = true;
+        m_poller = std::thread([this]() {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while (!m_wakeup.wait_for(lock, PollInterval, [this]() { return !m_running; }))
+                poll();
+        });
+    }
+
+    // Polls once more, growth right before exiting is not lost
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_running = false;
+        }
+        m_wakeup.notify_all();
+        if (m_poller.joinable()) {
+            m_poller.join();
+            poll();
+        }
+    }
+
+    uint64_t peakMemory() const
+    {
+        return m_peakMemory;
+    }
+
+    // Pages linear memory grew by since start(), however many memory.grow calls it took
+    uint32_t pagesGrown() const
+    {
+        return (uint32_t)(m_pages - m_initialPages);
+    }
+
+    uint32_t peakThreads() const
+    {
+        return m_peakThreads;
+    }
+
+private:
+    void poll()
+    {
+        const wasm_memory_inst_t memory = wasm_runtime_get_default_memory(m_moduleInst);
+        if (memory) {
+            const uint64_t pages = wasm_memory_get_cur_page_count(memory);
+            if (!m_polled)
+                m_initialPages = pages;
+            m_pages = pages;
+            m_peakMemory = std::max<uint64_t>(m_peakMemory, pages * wasm_memory_get_bytes_per_page(memory));
+        }
+
+#if WASM_ENABLE_THREAD_MGR != 0
+        WASMCluster* cluster = wasm_exec_env_get_cluster(m_execEnv);
+        if (cluster) {
+            os_mutex_lock(&cluster->lock);
+            const uint32_t threads = cluster->exec_env_list.len;
+            os_mutex_unlock(&cluster->lock);
+            m_peakThreads = std::max<uint32_t>(m_peakThreads, threads);
+        }
+#endif
+        m_peakThreads = std::max<uint32_t>(m_peakThreads, 1);
+        m_polled = true;
+    }
+
+    wasm_module_inst_t m_moduleInst;
+    wasm_exec_env_t m_execEnv;
+    bool m_running = false;
+    std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    std::thread m_poller;
+    bool m_polled = false;
+    uint64_t m_initialPages = 0;
+    uint64_t m_pages = 0;
+    uint64_t m_peakMemory = 0;
+    uint32_t m_peakThreads = 0;
+};
+
+#endif // WASMRUNMONITOR_H
@@ -1,7 +1,10 @@
 #ifndef WASMRUNNERINTERFACE_H
 #define WASMRUNNERINTERFACE_H
 
+#include <cstdint>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <memory>
@@ -11,25 +14,44 @@ typedef void* WasmRuntime;
 typedef void* WasmRuntimeHost;
 typedef void* WasmRuntimeConfig;
 
+// Collected for every run that got as far as calling main()
+struct WasmRunMetrics {
+    double loadMs = 0;
+    double instantiateMs = 0;
+    double mainMs = 0;
+    uint64_t peakMemory = 0;
+    uint32_t pagesGrown = 0;
+    uint32_t threadCount = 0;
+};
+
 class WasmRunnerHost {
 public:
     virtual void report(const std::string& msg) = 0;
     virtual void reportError(const std::string& err) = 0;
     virtual void reportExit(const int code) = 0;
     virtual void reportDebugPort(const uint32_t debugPort) = 0;
+    virtual void reportMetrics(const WasmRunMetrics& metrics) = 0;
 };
 
 enum WasmRunnerConfigFlags {
     None = 0,
     JIT = (1 << 0),
-    AOT = (1 << 1)
+    AOT = (1 << 1),
+    Mmap = (1 << 2),
+    Tiered = (1 << 3),
+    Pool = (1 << 4),
+    Profile = (1 << 5),
+    // Loads the binary anew on every run, e.g. to measure cold loads
+    NoModuleCache = (1 << 6)
 };
 
 struct WasmRunnerConfig {
     unsigned int threadCount = 0;
     unsigned int stackSize = 0;
     unsigned int heapSize = 0;
-    WasmRunnerConfigFlags flags;
+    // Tiered runs of binaries smaller than this (in KiB) wait for LLVM right away
+    unsigned int tierUpThreshold = 0;
+    WasmRunnerConfigFlags flags = None;
     std::vector<std::string> mapDirs;
 };
 
@@ -85,9 +107,21 @@ struct wamr_runtime {
     WasmRuntimeInterface (*interface)(WasmRuntime);
 };
 
-static std::shared_ptr<wamr_runtime> wamr_runtime_load(const char* path)
+// Runner libraries stay loaded for the lifetime of the process,
+// which keeps the runtime they carry warm between runs.
+inline std::shared_ptr<wamr_runtime> wamr_runtime_load(const char* path)
 {
+    static std::mutex loadedMutex;
+    static std::map<std::string, std::shared_ptr<wamr_runtime>> loaded;
+
+    std::lock_guard<std::mutex> lock(loadedMutex);
+    const auto it = loaded.find(path);
+    if (it != loaded.end())
+        return it->second;
+
     std::shared_ptr<wamr_runtime> plugin = std::make_shared<wamr_runtime>(path);
+    if (plugin->handle)
+        loaded.emplace(path, plugin);
     return plugin;
 }
 
@@ -24,196 +24,216 @@
 #ifndef QOWNLANGUAGEDATA_H
 #define QOWNLANGUAGEDATA_H
 
-template<typename key, typename val>
-class QMultiHash;
+#include <array>
+#include <cstddef>
 
-class QLatin1String;
-
-using LanguageData = QMultiHash<char, QLatin1String>;
+/**
+ * @brief A single highlighted word and the character it's looked up by
+ */
+struct LanguageWord {
+    char key = 0;
+    const char *word = nullptr;
+    int size = 0;
+
+    constexpr LanguageWord() = default;
+    constexpr LanguageWord(const char k, const char *w)
+        : key(k), word(w), size(length(w)) {}
+
+private:
+    static constexpr int length(const char *w) {
+        int len = 0;
+        while (w[len] != '\0')
+            ++len;
+        return len;
+    }
+};
+
+/**
+ * @brief Immutable word table, bucketed by lookup character at compile time
+ *
+ * Words sharing a key are stored next to each other,
+ * offsets[key] and offsets[key + 1] delimit that bucket.
+ */
+template<std::size_t N>
+struct LanguageTable {
+    std::array<LanguageWord, N> words{};
+    std::array<unsigned short, 257> offsets{};
+};
+
+template<std::size_t N>
+constexpr LanguageTable<N> makeLanguageTable(const LanguageWord (&words)[N])
+{
+    static_assert(N < 0xFFFF, "Language table too large");
+
+    LanguageTable<N> table{};
+    std::array<unsigned short, 257> fill{};
+
+    // Counting sort on the key keeps the original order within a bucket
+    for (std::size_t i = 0; i < N; ++i)
+        ++table.offsets[static_cast<unsigned char>(words[i].key) + 1];
+    for (std::size_t i = 1; i < table.offsets.size(); ++i)
+        table.offsets[i] += table.offsets[i - 1];
+
+    fill = table.offsets;
+    for (std::size_t i = 0; i < N; ++i)
+        table.words[fill[static_cast<unsigned char>(words[i].key)]++] = words[i];
+
+    return table;
+}
+
+/**
+ * @brief Non-owning view on a LanguageTable, cheap to pass around
+ */
+class LanguageData {
+public:
+    struct Range {
+        const LanguageWord *first;
+        const LanguageWord *last;
+
+        constexpr const LanguageWord *begin() const { return first; }
+        constexpr const LanguageWord *end() const { return last; }
+        constexpr bool isEmpty() const { return first == last; }
+    };
+
+    constexpr LanguageData() = default;
+
+    template<std::size_t N>
+    constexpr LanguageData(const LanguageTable<N> &table)
+        : m_words(table.words.data()), m_offsets(table.offsets.data()) {}
+
+    /**
+     * @brief returns all words that are looked up by key
+     * @param key the character at the current position
+     */
+    constexpr Range values(const char key) const {
+        if (!m_offsets)
+            return Range{nullptr, nullptr};
+        const auto k = static_cast<unsigned char>(key);
+        return Range{m_words + m_offsets[k], m_words + m_offsets[k + 1]};
+    }
+
+    constexpr bool contains(const char key) const {
+        return !values(key).isEmpty();
+    }
+
+private:
+    const LanguageWord *m_words = nullptr;
+    const unsigned short *m_offsets = nullptr;
+};
+
+/**
+ * @brief All word tables of a single language, statically allocated
+ */
+struct LanguageDefinition {
+    LanguageData types;
+    LanguageData keywords;
+    LanguageData builtin;
+    LanguageData literals;
+    LanguageData other;
+};
 
 /**********************************************************/
 /* LuaData ************************************************/
 /**********************************************************/
-void loadLuaData(LanguageData &typess,
-                 LanguageData &keywordss,
-                 LanguageData &builtins,
-                 LanguageData &literalss,
-                 LanguageData &others);
+const LanguageDefinition &luaLanguageData();
 
 /**********************************************************/
 /* C/C++ Data *********************************************/
 /**********************************************************/
-void loadCppData(LanguageData &typess,
-             LanguageData &keywordss,
-             LanguageData &builtins,
-             LanguageData &literalss,
-             LanguageData &others);
+const LanguageDefinition &cppLanguageData();
 
 /**********************************************************/
 /* Shell Data *********************************************/
 /**********************************************************/
-void loadShellData(LanguageData &types,
-             LanguageData &keywords,
-             LanguageData &builtin,
-             LanguageData &literals,
-             LanguageData &other);
+const LanguageDefinition &shellLanguageData();
 
 /**********************************************************/
 /* JS Data *********************************************/
 /**********************************************************/
-void loadJSData(LanguageData &types,
-             LanguageData &keywords,
-             LanguageData &builtin,
-             LanguageData &literals,
-             LanguageData &other);
+const LanguageDefinition &jsLanguageData();
 
 /**********************************************************/
 /* PHP Data *********************************************/
 /**********************************************************/
-void loadPHPData(LanguageData &types,
-             LanguageData &keywords,
-             LanguageData &builtin,
-             LanguageData &literals,
-             LanguageData &other);
+const LanguageDefinition &phpLanguageData();
 
 /**********************************************************/
 /* QML Data *********************************************/
 /**********************************************************/
-void loadQMLData(LanguageData &types,
-             LanguageData &keywords,
-             LanguageData &builtin,
-             LanguageData &literals,
-             LanguageData &other);
+const LanguageDefinition &qmlLanguageData();
 
 /**********************************************************/
 /* Python Data *********************************************/
 /**********************************************************/
-void loadPythonData(LanguageData &types,
-             LanguageData &keywords,
-             LanguageData &builtin,
-             LanguageData &literals,
-             LanguageData &other);
+const LanguageDefinition &pythonLanguageData();
 
 /********************************************************/
 /***   Rust DATA      ***********************************/
 /********************************************************/
-void loadRustData(LanguageData &types,
-             LanguageData &keywords,
-             LanguageData &builtin,
-             LanguageData &literals,
-             LanguageData &other);
+const LanguageDefinition &rustLanguageData();
 
 /********************************************************/
 /***   Java DATA      ***********************************/
 /********************************************************/
-void loadJavaData(LanguageData &types,
-             LanguageData &keywords,
-             LanguageData &builtin,
-             LanguageData &literals,
-             LanguageData &other);
+const LanguageDefinition &javaLanguageData();
 
 /********************************************************/
 /***   C# DATA      *************************************/
 /********************************************************/
-void loadCSharpData(LanguageData &types,
-             LanguageData &keywords,
-             LanguageData &builtin,
-             LanguageData &literals,
-             LanguageData &other);
+const LanguageDefinition &csharpLanguageData();
 
 /********************************************************/
 /***   Go DATA      *************************************/
 /********************************************************/
-void loadGoData(LanguageData &types,
-             LanguageData &keywords,
-             LanguageData &builtin,
-             LanguageData &literals,
-             LanguageData &other);
+const LanguageDefinition &goLanguageData();
 
 /********************************************************/
 /***   V DATA      **************************************/
 /********************************************************/
-void loadVData(LanguageData &types,
-             LanguageData &keywords,
-             LanguageData &builtin,
-             LanguageData &literals,
-             LanguageData &other);
+const LanguageDefinition &vLanguageData();
 
 /********************************************************/
 /***   SQL DATA      ************************************/
 /********************************************************/
-void loadSQLData(LanguageData &types,
-             LanguageData &keywords,
-             LanguageData &builtin,
-             LanguageData &literals,
-             LanguageData &other);
+const LanguageDefinition &sqlLanguageData();
 
 /********************************************************/
 /***   JSON DATA      ***********************************/
 /********************************************************/
-void loadJSONData(LanguageData &types,
-             LanguageData &keywords,
-             LanguageData &builtin,
-             LanguageData &literals,
-             LanguageData &other);
+const LanguageDefinition &jsonLanguageData();
 
 /********************************************************/
 /***   CSS DATA      ***********************************/
 /********************************************************/
-void loadCSSData(LanguageData &types,
-             LanguageData &keywords,
-             LanguageData &builtin,
-             LanguageData &literals,
-             LanguageData &other);
+const LanguageDefinition &cssLanguageData();
 
 /********************************************************/
 /***   Typescript DATA  *********************************/
 /********************************************************/
-void loadTypescriptData(LanguageData &types,
-             LanguageData &keywords,
-             LanguageData &builtin,
-             LanguageData &literals,
-             LanguageData &other);
+const LanguageDefinition &typescriptLanguageData();
 
 /********************************************************/
 /***   YAML DATA  ***************************************/
 /********************************************************/
-void loadYAMLData(LanguageData &types,
-             LanguageData &keywords,
-             LanguageData &builtin,
-             LanguageData &literals,
-             LanguageData &other);
+const LanguageDefinition &yamlLanguageData();
 
 /********************************************************/
 /***   VEX DATA   ***************************************/
 /********************************************************/
-void loadVEXData(LanguageData &types,
-             LanguageData &keywords,
-             LanguageData &builtin,
-             LanguageData &literals,
-             LanguageData &other);
+const LanguageDefinition &vexLanguageData();
 
 /********************************************************/
 /***   CMake DATA  **************************************/
 /********************************************************/
-void loadCMakeData(QMultiHash<char, QLatin1String> &types,
-             QMultiHash<char, QLatin1String> &keywords,
-             QMultiHash<char, QLatin1String> &builtin,
-             QMultiHash<char, QLatin1String> &literals,
-             QMultiHash<char, QLatin1String> &other);
+const LanguageDefinition &cmakeLanguageData();
 
 /********************************************************/
 /***   Make DATA  ***************************************/
 /********************************************************/
-void loadMakeData(QMultiHash<char, QLatin1String>& types,
-    QMultiHash<char, QLatin1String>& keywords,
-    QMultiHash<char, QLatin1String>& builtin,
-    QMultiHash<char, QLatin1String>& literals,
-    QMultiHash<char, QLatin1String>& other);
-
-void loadAsmData(QMultiHash<char, QLatin1String>& types,
-    QMultiHash<char, QLatin1String>& keywords,
-    QMultiHash<char, QLatin1String>& builtin,
-    QMultiHash<char, QLatin1String>& literals,
-    QMultiHash<char, QLatin1String>& other);
+const LanguageDefinition &makeLanguageData();
+
+/********************************************************/
+/***   ASM DATA   ***************************************/
+/********************************************************/
+const LanguageDefinition &asmLanguageData();
 #endif
@@ -27,12 +27,15 @@
 
 #include <QDebug>
 #include <algorithm>
+#include <QAbstractTextDocumentLayout>
 #include <QTextDocument>
+#include <QTextLayout>
 
 QSourceHighliter::QSourceHighliter(QTextDocument *doc)
     : QSyntaxHighlighter(doc),
       _language(CodeC)
 {
+    initIncrementalHighlighting();
     initFormats();
 }
 
@@ -40,9 +43,18 @@ QSourceHighliter::QSourceHighliter(QTextDocument *doc, QSourceHighliter::Themes
     : QSyntaxHighlighter(doc),
       _language(CodeC)
 {
+    initIncrementalHighlighting();
     setTheme(theme);
 }
 
+void QSourceHighliter::initIncrementalHighlighting()
+{
+    _rehighlightTimer.setSingleShot(true);
+    _rehighlightTimer.setInterval(0);
+    QObject::connect(&_rehighlightTimer, &QTimer::timeout,
+                     this, &QSourceHighliter::continueRehighlight);
+}
+
 void QSourceHighliter::initFormats() {
     /****************************************
      * Formats for syntax highlighting
@@ -82,8 +94,11 @@ void QSourceHighliter::initFormats() {
 }
 
 void QSourceHighliter::setCurrentLanguage(Language language) {
-    if (language != _language)
-        _language = language;
+    if (language == _language)
+        return;
+
+    _language = language;
+    rehighlightIncrementally();
 }
 
 QSourceHighliter::Language QSourceHighliter::currentLanguage() {
@@ -93,22 +108,217 @@ QSourceHighliter::Language QSourceHighliter::currentLanguage() {
 void QSourceHighliter::setTheme(QSourceHighliter::Themes theme)
 {
     _formats = QSourceHighliterTheme::theme(theme);
-    rehighlight();
+    rehighlightIncrementally();
 }
 
 void QSourceHighliter::highlightBlock(const QString &text)
 {
-    if (currentBlock() == document()->firstBlock()) {
-        setCurrentBlockState(_language);
+    if (_inPass) {
+        // rehighlightBlock() carries on into the following blocks as long as
+        // their state changes, within a pass only the requested one is done.
+        if (currentBlock().blockNumber() != _passBlock) {
+            keepCurrentBlock();
+            return;
+        }
     } else {
-        previousBlockState() == _language ?
-                    setCurrentBlockState(_language) :
-                    setCurrentBlockState(_language + 1);
+        // Anything not driven by our own chunks is a synchronous run
+        // started by QSyntaxHighlighter (document edits, rehighlight()).
+        if (!_burstTimer.isValid()) {
+            _burstTimer.start();
+            QTimer::singleShot(0, this, &QSourceHighliter::finishBurst);
+        } else if (_burstTimer.elapsed() > RehighlightBudgetMs) {
+            keepCurrentBlock();
+            return;
+        }
     }
 
+    ++_rehighlightedBlocks;
+    setCurrentBlockState(incomingState(currentBlock()));
     highlightSyntax(text);
 }
 
+/**
+ * @brief Returns the state a block starts in, based on the block before it
+ * @details Blocks following a block of another language or one that
+ * hasn't been highlighted yet are treated as code.
+ */
+int QSourceHighliter::incomingState(const QTextBlock &block) const
+{
+    if (!block.isValid() || block == document()->firstBlock())
+        return _language;
+
+    return block.previous().userState() == _language + 1 ?
+                _language + 1 :
+                _language;
+}
+
+void QSourceHighliter::rehighlightIncrementally()
+{
+    if (!document())
+        return;
+
+    _aheadBlocks.clear();
+    _pendingFrom = 0;
+    _pendingTo = document()->blockCount() - 1;
+
+    highlightVisibleBlocks();
+    _rehighlightTimer.start();
+}
+
+void QSourceHighliter::setVisibleArea(qreal y, qreal height)
+{
+    QTextDocument *doc = document();
+    if (!doc || !doc->documentLayout())
+        return;
+
+    QAbstractTextDocumentLayout *layout = doc->documentLayout();
+    const int top = layout->hitTest(QPointF(0, y), Qt::FuzzyHit);
+    const int bottom = layout->hitTest(QPointF(0, y + height), Qt::FuzzyHit);
+
+    _firstVisibleBlock = doc->findBlock(qMax(0, top)).blockNumber();
+    _lastVisibleBlock = bottom < 0 ?
+                doc->blockCount() - 1 :
+                doc->findBlock(bottom).blockNumber();
+
+    if (_pendingFrom >= 0)
+        highlightVisibleBlocks();
+}
+
+int QSourceHighliter::lastRehighlightedBlocks() const
+{
+    return _lastRehighlightedBlocks;
+}
+
+/**
+ * @brief Leaves the current block as it is and queues it for the pass
+ * @details The block keeps its old state, so QSyntaxHighlighter stops
+ * cascading into the following blocks, and its old formats until then.
+ */
+void QSourceHighliter::keepCurrentBlock()
+{
+    const QTextBlock block = currentBlock();
+    if (block.layout()) {
+        for (const QTextLayout::FormatRange &range : block.layout()->formats())
+            setFormat(range.start, range.length, range.format);
+    }
+    deferBlock(block.blockNumber());
+}
+
+void QSourceHighliter::deferBlock(int blockNumber)
+{
+    if (_pendingFrom < 0 || blockNumber < _pendingFrom)
+        _pendingFrom = blockNumber;
+    if (blockNumber > _pendingTo)
+        _pendingTo = blockNumber;
+}
+
+/**
+ * @brief Highlights the pending blocks inside the viewport ahead of the rest
+ * @details The state each block was started with is remembered so that
+ * the sequential pass can skip it if nothing above it changed.
+ */
+void QSourceHighliter::highlightVisibleBlocks()
+{
+    if (_pendingFrom < 0 || !document())
+        return;
+
+    const int first = qMax(_firstVisibleBlock, _pendingFrom);
+    const int last = qMin(_lastVisibleBlock, _pendingTo);
+
+    _inPass = true;
+    for (QTextBlock block = document()->findBlockByNumber(first);
+         block.isValid() && block.blockNumber() <= last;
+         block = block.next()) {
+        _aheadBlocks.insert(block.blockNumber(), incomingState(block));
+        _passBlock = block.blockNumber();
+        rehighlightBlock(block);
+    }
+    _inPass = false;
+    _passBlock = -1;
+}
+
+/**
+ * @brief Works through the pending blocks for one time slice
+ * @details Every block up to _pendingTo is reformatted, after that the
+ * pass stops as soon as a block ends in the same state as before.
+ */
+void QSourceHighliter::continueRehighlight()
+{
+    if (_pendingFrom < 0)
+        return;
+
+    if (!document()) {
+        _pendingFrom = _pendingTo = -1;
+        _aheadBlocks.clear();
+        return;
+    }
+
+    QElapsedTimer slice;
+    slice.start();
+
+    _inPass = true;
+    QTextBlock block = document()->findBlockByNumber(_pendingFrom);
+    while (block.isValid() && slice.elapsed() < RehighlightBudgetMs) {
+        const int number = block.blockNumber();
+        const int stateBefore = block.userState();
+
+        const auto ahead = _aheadBlocks.constFind(number);
+        if (ahead != _aheadBlocks.constEnd()) {
+            const bool upToDate = (ahead.value() == incomingState(block));
+            _aheadBlocks.erase(ahead);
+            if (upToDate) {
+                block = block.next();
+                continue;
+            }
+        }
+
+        _passBlock = number;
+        rehighlightBlock(block);
+
+        if (number >= _pendingTo && block.userState() == stateBefore) {
+            block = QTextBlock();
+            break;
+        }
+        block = block.next();
+    }
+    _inPass = false;
+    _passBlock = -1;
+
+    if (block.isValid()) {
+        _pendingFrom = block.blockNumber();
+        _rehighlightTimer.start();
+        return;
+    }
+
+    _pendingFrom = _pendingTo = -1;
+    _aheadBlocks.clear();
+    reportRehighlightedBlocks();
+}
+
+void QSourceHighliter::finishBurst()
+{
+    _burstTimer.invalidate();
+
+    if (_pendingFrom >= 0) {
+        highlightVisibleBlocks();
+        if (!_rehighlightTimer.isActive())
+            _rehighlightTimer.start();
+        return;
+    }
+
+    reportRehighlightedBlocks();
+}
+
+void QSourceHighliter::reportRehighlightedBlocks()
+{
+    if (_rehighlightedBlocks == 0)
+        return;
+
+    _lastRehighlightedBlocks = _rehighlightedBlocks;
+    _rehighlightedBlocks = 0;
+    emit blocksRehighlighted(_lastRehighlightedBlocks);
+}
+
 /**
  * @brief Does the code syntax highlighting
  * @param text
@@ -126,71 +336,68 @@ void QSourceHighliter::highlightSyntax(const QString &text)
     bool isAsm = false;
     bool isSQL = false;
 
-    LanguageData keywords{},
-                others{},
-                types{},
-                builtin{},
-                literals{};
+    static constexpr LanguageDefinition noLanguageData{};
+    const LanguageDefinition *data = &noLanguageData;
 
     switch (currentBlockState()) {
         case CodeLua :
         case CodeLuaComment :
-            loadLuaData(types, keywords, builtin, literals, others);
+            data = &luaLanguageData();
             break;
         case CodeCpp :
         case CodeCppComment :
-            loadCppData(types, keywords, builtin, literals, others);
+            data = &cppLanguageData();
             break;
         case CodeJs :
         case CodeJsComment :
-            loadJSData(types, keywords, builtin, literals, others);
+            data = &jsLanguageData();
             break;
         case CodeC :
         case CodeCComment :
-            loadCppData(types, keywords, builtin, literals, others);
+            data = &cppLanguageData();
             break;
         case CodeBash :
-            loadShellData(types, keywords, builtin, literals, others);
+            data = &shellLanguageData();
             comment = QLatin1Char('#');
             break;
         case CodePHP :
         case CodePHPComment :
-            loadPHPData(types, keywords, builtin, literals, others);
+            data = &phpLanguageData();
             break;
         case CodeQML :
         case CodeQMLComment :
-            loadQMLData(types, keywords, builtin, literals, others);
+            data = &qmlLanguageData();
             break;
         case CodePython :
-            loadPythonData(types, keywords, builtin, literals, others);
+            data = &pythonLanguageData();
             comment = QLatin1Char('#');
             break;
         case CodeRust :
         case CodeRustComment :
-            loadRustData(types, keywords, builtin, literals, others);
+            data = &rustLanguageData();
             break;
         case CodeJava :
         case CodeJavaComment :
-            loadJavaData(types, keywords, builtin, literals, others);
+            data = &javaLanguageData();
             break;
         case CodeCSharp :
         case CodeCSharpComment :
-            loadCSharpData(types, keywords, builtin, literals, others);
+            data = &csharpLanguageData();
             break;
         case CodeGo :
         case CodeGoComment :
-            loadGoData(types, keywords, builtin, literals, others);
+            data = &goLanguageData();
             break;
         case CodeV :
         case CodeVComment :
-            loadVData(types, keywords, builtin, literals, others);
+            data = &vLanguageData();
             break;
         case CodeSQL :
             isSQL = true;
-            loadSQLData(types, keywords, builtin, literals, others);
+            data = &sqlLanguageData();
             break;
         case CodeJSON :
-            loadJSONData(types, keywords, builtin, literals, others);
+            data = &jsonLanguageData();
             break;
         case CodeXML :
             xmlHighlighter(text);
@@ -198,15 +405,15 @@ void QSourceHighliter::highlightSyntax(const QString &text)
         case CodeCSS :
         case CodeCSSComment :
             isCSS = true;
-            loadCSSData(types, keywords, builtin, literals, others);
+            data = &cssLanguageData();
             break;
         case CodeTypeScript:
         case CodeTypeScriptComment:
-            loadTypescriptData(types, keywords, builtin, literals, others);
+            data = &typescriptLanguageData();
             break;
         case CodeYAML:
             isYAML = true;
-            loadYAMLData(types, keywords, builtin, literals, others);
+            data = &yamlLanguageData();
             comment = QLatin1Char('#');
             break;
         case CodeINI:
@@ -214,20 +421,20 @@ void QSourceHighliter::highlightSyntax(const QString &text)
             break;
         case CodeVex:
         case CodeVexComment:
-            loadVEXData(types, keywords, builtin, literals, others);
+            data = &vexLanguageData();
             break;
         case CodeCMake:
-            loadCMakeData(types, keywords, builtin, literals, others);
+            data = &cmakeLanguageData();
             comment = QLatin1Char('#');
             break;
         case CodeMake:
             isMake = true;
-            loadMakeData(types, keywords, builtin, literals, others);
+            data = &makeLanguageData();
             comment = QLatin1Char('#');
             break;
         case CodeAsm:
             isAsm = true;
-            loadAsmData(types, keywords, builtin, literals, others);
+            data = &asmLanguageData();
             comment = QLatin1Char('#');
             break;
         default:
@@ -241,22 +448,25 @@ void QSourceHighliter::highlightSyntax(const QString &text)
     setFormat(0, textLen, _formats[CodeBlock]);
 
     auto applyCodeFormat =
-        [this](int i, const LanguageData &data,
-               const QString &text, const QTextCharFormat &fmt) -> int {
+        [this, textLen](int i, const LanguageData &data,
+                        const QString &text, const QTextCharFormat &fmt) -> int {
         // check if we are at the beginning OR if this is the start of a word
         if (i == 0 || (!text.at(i - 1).isLetterOrNumber() &&
                        text.at(i-1) != QLatin1Char('_'))) {
-            const auto wordList = data.values(text.at(i).toLatin1());
-            for (const QLatin1String &word : wordList) {
+            for (const LanguageWord &word : data.values(text.at(i).toLatin1())) {
                 // we have a word match check
-                // 1. if we are at the end
-                // 2. if we have a complete word
-                if (word == strMidRef(text, i, word.size()) &&
-                    (i + word.size() == text.length() ||
-                     (!text.at(i + word.size()).isLetterOrNumber() &&
-                      text.at(i + word.size()) != QLatin1Char('_')))) {
-                    setFormat(i, word.size(), fmt);
-                    i += word.size();
+                // 1. if it fits into the rest of the text
+                // 2. if we are at the end or have a complete word
+                // 3. only then compare the actual characters
+                const int end = i + word.size;
+                if (end > textLen)
+                    continue;
+                if (end != textLen &&
+                    (text.at(end).isLetterOrNumber() || text.at(end) == QLatin1Char('_')))
+                    continue;
+                if (QLatin1String(word.word, word.size) == strMidRef(text, i, word.size)) {
+                    setFormat(i, word.size, fmt);
+                    return end;
                 }
             }
         }
@@ -347,7 +557,7 @@ void QSourceHighliter::highlightSyntax(const QString &text)
         if (i >= textLen || !text[i].isLetter()) continue;
 
         /* Highlight Types */
-        i = applyCodeFormat(i, types, text, formatType);
+        i = applyCodeFormat(i, data->types, text, formatType);
         /************************************************
          next letter is usually a space, in that case
          going forward is useless, so continue;
@@ -363,37 +573,37 @@ void QSourceHighliter::highlightSyntax(const QString &text)
         }
 
         /* Highlight Keywords */
-        i = applyCodeFormat(i, keywords, text, formatKeyword);
+        i = applyCodeFormat(i, data->keywords, text, formatKeyword);
         if (i >= textLen || !text[i].isLetter()) {
             continue;
         }
 
         /* Highlight Literals (true/false/NULL,nullptr) */
-        i = applyCodeFormat(i, literals, text, formatNumLit);
+        i = applyCodeFormat(i, data->literals, text, formatNumLit);
         if (i >= textLen || !text[i].isLetter()) {
             continue;
         }
 
         /* Highlight Builtin library stuff */
-        i = applyCodeFormat(i, builtin, text, formatBuiltIn);
+        i = applyCodeFormat(i, data->builtin, text, formatBuiltIn);
         if (i >= textLen || !text[i].isLetter()) {
             continue;
         }
 
         /* Highlight other stuff (preprocessor etc.) */
-        if (( i == 0 || !text.at(i-1).isLetter()) && others.contains(text[i].toLatin1())) {
-            const QList<QLatin1String> wordList = others.values(text[i].toLatin1());
-            for(const QLatin1String &word : wordList) {
-                if (word == strMidRef(text, i, word.size()) // we have a word match
-                        &&
-                        (i + word.size() == text.length() // check if we are at the end
-                         ||
-                         !text.at(i + word.size()).isLetter()) //OR if we have a complete word
-                        ) {
+        if (i == 0 || !text.at(i-1).isLetter()) {
+            for (const LanguageWord &word : data->other.values(text[i].toLatin1())) {
+                const int end = i + word.size;
+                if (end > textLen) // no room for this word
+                    continue;
+                if (end != textLen && text.at(end).isLetter()) // not a complete word
+                    continue;
+                if (QLatin1String(word.word, word.size) == strMidRef(text, i, word.size)) {
                     currentBlockState() == CodeCpp ?
-                                setFormat(i - 1, word.size() + 1, formatOther) :
-                                setFormat(i, word.size(), formatOther);
-                    i += word.size();
+                                setFormat(i - 1, word.size + 1, formatOther) :
+                                setFormat(i, word.size, formatOther);
+                    i = end;
+                    break;
                 }
             }
         }
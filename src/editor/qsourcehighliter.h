@@ -25,6 +25,10 @@
 #define QSOURCEHIGHLITER_H
 
 #include <QSyntaxHighlighter>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QTextBlock>
+#include <QTimer>
 
 #if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
 #include <QStringView>
@@ -112,10 +116,44 @@ public:
     Q_REQUIRED_RESULT Language currentLanguage();
     void setTheme(Themes theme);
 
+    /**
+     * @brief Rehighlights the whole document without blocking the GUI thread
+     * @details Blocks in the visible area are formatted right away,
+     * the rest follows in time-sliced chunks from the top of the document.
+     */
+    void rehighlightIncrementally();
+
+    /**
+     * @brief Sets the part of the document that is currently visible
+     * @param y the vertical scroll offset in document coordinates
+     * @param height the height of the viewport
+     */
+    void setVisibleArea(qreal y, qreal height);
+
+    /**
+     * @brief returns how many blocks the last edit or rehighlight touched
+     */
+    Q_REQUIRED_RESULT int lastRehighlightedBlocks() const;
+
+signals:
+    void blocksRehighlighted(int count);
+
 protected:
     void highlightBlock(const QString &text) override;
 
 private:
+    // Time a single synchronous run may spend before the rest is deferred
+    static constexpr qint64 RehighlightBudgetMs = 8;
+
+    void initIncrementalHighlighting();
+    Q_REQUIRED_RESULT int incomingState(const QTextBlock &block) const;
+    void deferBlock(int blockNumber);
+    void keepCurrentBlock();
+    void highlightVisibleBlocks();
+    void continueRehighlight();
+    void finishBurst();
+    void reportRehighlightedBlocks();
+
     void highlightSyntax(const QString &text);
     Q_REQUIRED_RESULT int highlightNumericLiterals(const QString &text, int i);
     Q_REQUIRED_RESULT int highlightStringLiterals(const QChar strType, const QString &text, int i);
@@ -164,6 +202,19 @@ private:
 
     QHash<Token, QTextCharFormat> _formats;
     Language _language;
+
+    // Incremental rehighlighting state
+    QTimer _rehighlightTimer;
+    QElapsedTimer _burstTimer;
+    QHash<int, int> _aheadBlocks;
+    int _pendingFrom = -1;
+    int _pendingTo = -1;
+    int _firstVisibleBlock = 0;
+    int _lastVisibleBlock = 0;
+    int _rehighlightedBlocks = 0;
+    int _lastRehighlightedBlocks = 0;
+    bool _inPass = false;
+    int _passBlock = -1;
 };
 
 #endif // QSOURCEHIGHLITER_H
@@ -6,6 +6,11 @@ SyntaxHighlighter::SyntaxHighlighter(QObject *parent)
 
 }
 
+int SyntaxHighlighter::rehighlightedBlocks() const
+{
+    return m_rehighlightedBlocks;
+}
+
 void SyntaxHighlighter::init(QQuickTextDocument* doc, const bool lightTheme)
 {
     if (this->m_highlighter) {
@@ -18,6 +23,14 @@ void SyntaxHighlighter::init(QQuickTextDocument* doc, const bool lightTheme)
         this->m_highlighter = new QSourceHighliter(doc->textDocument());
     else
         this->m_highlighter = new QSourceHighliter(doc->textDocument(), QSourceHighliter::Monokai);
+
+    QObject::connect(this->m_highlighter, &QSourceHighliter::blocksRehighlighted,
+                     this, [=](int count) {
+        this->m_rehighlightedBlocks = count;
+        emit rehighlightedBlocksChanged();
+    });
+
+    this->m_highlighter->setVisibleArea(this->m_visibleY, this->m_visibleHeight);
 }
 
 
@@ -27,5 +40,15 @@ void SyntaxHighlighter::setCurrentLanguage(QSourceHighliter::Language language)
         return;
 
     this->m_highlighter->setCurrentLanguage(language);
-    this->m_highlighter->rehighlight();
+}
+
+void SyntaxHighlighter::setVisibleArea(qreal y, qreal height)
+{
+    this->m_visibleY = y;
+    this->m_visibleHeight = height;
+
+    if (!this->m_highlighter)
+        return;
+
+    this->m_highlighter->setVisibleArea(y, height);
 }
@@ -9,15 +9,26 @@
 class SyntaxHighlighter : public QObject
 {
     Q_OBJECT
+    Q_PROPERTY(int rehighlightedBlocks READ rehighlightedBlocks NOTIFY rehighlightedBlocksChanged)
+
 public:
     explicit SyntaxHighlighter(QObject *parent = nullptr);
 
+    int rehighlightedBlocks() const;
+
 public slots:
     void init(QQuickTextDocument* doc, const bool lightTheme);
     void setCurrentLanguage(QSourceHighliter::Language language);
+    void setVisibleArea(qreal y, qreal height);
 
 private:
     QSourceHighliter* m_highlighter;
+    qreal m_visibleY = 0;
+    qreal m_visibleHeight = 0;
+    int m_rehighlightedBlocks = 0;
+
+signals:
+    void rehighlightedBlocksChanged();
 };
 
 #endif // SYNTAXHIGHLIGHTER_H
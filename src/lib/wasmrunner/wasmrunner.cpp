@@ -16,13 +16,16 @@
 
 #include <pthread.h>
 #include <stdint.h>
+#include <chrono>
 #include <memory>
 #include <vector>
 
 #include <wasm_c_api.h>
 #include <wasm_export.h>
 
+#include "common/wasmmodulecache.h"
 #include "common/wasmrunnerinterface.h"
+#include "common/wasmrunmonitor.h"
 
 #include "bh_read_file.h"
 
@@ -39,11 +42,68 @@ struct WasmRunnerImplSharedData {
     wasm_exec_env_t exec_env = nullptr;
     bool killing;
     bool killed;
-    bool initialized;
+    bool initialized = false;
     WasmRunnerConfig configuration;
     std::mutex runtimeMutex;
 };
 
+// The runtime is initialized once per process and kept warm between runs,
+// only modules and their instances are created and destroyed per exec().
+// It is set up again only if no run is in flight and the thread limit changed.
+struct WasmRunnerRuntime {
+    std::mutex mutex;
+    bool initialized = false;
+    unsigned int threadCount = 0;
+    unsigned int users = 0;
+};
+
+static WasmRunnerRuntime runtime;
+
+static bool acquire_wamr_runtime(const WasmRunnerConfig& config, bool* warm)
+{
+    std::lock_guard<std::mutex> lock(runtime.mutex);
+
+    *warm = runtime.initialized &&
+            (runtime.threadCount == config.threadCount || runtime.users > 0);
+    if (*warm) {
+        runtime.users++;
+        return true;
+    }
+
+    if (runtime.initialized) {
+        wasm_runtime_destroy();
+        runtime.initialized = false;
+    }
+
+    RuntimeInitArgs init_args;
+    memset(&init_args, 0, sizeof(RuntimeInitArgs));
+
+    strcpy(init_args.ip_addr, "127.0.0.1");
+    init_args.instance_port = 0;
+    init_args.mem_alloc_type = Alloc_With_System_Allocator;
+    init_args.max_thread_num = config.threadCount;
+
+    if (!wasm_runtime_full_init(&init_args))
+        return false;
+
+    // Register native API bindings
+    //register_wamr_opengles_bindings();
+    //register_wamr_tideui_bindings();
+    //register_wamr_sdl2_bindings();
+
+    runtime.initialized = true;
+    runtime.threadCount = config.threadCount;
+    runtime.users++;
+    return true;
+}
+
+static void release_wamr_runtime()
+{
+    std::lock_guard<std::mutex> lock(runtime.mutex);
+    if (runtime.users > 0)
+        runtime.users--;
+}
+
 class WasmRunnerImpl : public WasmRunnerInterface
 {
 public:
@@ -82,11 +142,18 @@ int WasmRunnerImpl::exec(const std::string& path, int argc, char** argv, int std
     uint32_t ns_lookup_pool_size = 1;
     std::vector<const char*> mappedDirs { "/::/" , readableDir.c_str() };
     std::vector<const char*> env;
-    RuntimeInitArgs init_args;
 
     wasm_exec_env_t debug_exec_env;
     uint32_t debug_port;
     int exitCode = -1;
+    bool warm = false;
+    bool threadEnv = false;
+    WasmModuleBuffer buffer;
+    bool executed = false;
+    WasmRunMetrics metrics;
+    std::unique_ptr<WasmRunMonitor> monitor;
+    const auto startTime = std::chrono::steady_clock::now();
+    auto lapTime = startTime;
 
     std::lock_guard<std::mutex> lock(shared.runtimeMutex);
 
@@ -96,32 +163,29 @@ int WasmRunnerImpl::exec(const std::string& path, int argc, char** argv, int std
         return exitCode;
     }
 
-    // Initialize
-    memset(&init_args, 0, sizeof(RuntimeInitArgs));
-
-    strcpy(init_args.ip_addr, "127.0.0.1");
-    init_args.instance_port = 0;
-    init_args.mem_alloc_type = Alloc_With_System_Allocator;
-    init_args.max_thread_num = shared.configuration.threadCount;
-
-    wasm_runtime_full_init(&init_args);
-
-    // Register native API bindings
-    //register_wamr_opengles_bindings();
-    //register_wamr_tideui_bindings();
-    //register_wamr_sdl2_bindings();
-
-    if (!wasm_runtime_full_init(&init_args)) {
+    if (!acquire_wamr_runtime(shared.configuration, &warm)) {
         hostInterface->reportError("Failed to initialize WASM runtime");
         goto fail;
     }
 
     shared.initialized = true;
 
-    unsigned int siz; siz = 0;
-    uint8_t* buf; buf = (uint8_t*)bh_read_file_to_buffer(path.c_str(), &siz);
+    // Every run gets a thread of its own, not necessarily the one that initialized the runtime
+    if (!wasm_runtime_thread_env_inited()) {
+        if (!wasm_runtime_init_thread_env()) {
+            hostInterface->reportError("Failed to initialize WASM thread environment");
+            goto fail;
+        }
+        threadEnv = true;
+    }
+
+    wasm_run_lap(&lapTime);
+    if (!wasm_module_buffer_open(path, (shared.configuration.flags & WasmRunnerConfigFlags::Mmap), &buffer)) {
+        hostInterface->reportError("Failed to read file: " + path);
+        goto fail;
+    }
 
-    shared.module = wasm_runtime_load(buf, siz, error_buf, sizeof(error_buf));
+    shared.module = wasm_runtime_load(buffer.data, buffer.size, error_buf, sizeof(error_buf));
     if (!shared.module) {
         std::string reason; reason = std::string(error_buf);
         std::string err; err = "Failed to load wasm module: " + reason;
@@ -129,6 +193,8 @@ int WasmRunnerImpl::exec(const std::string& path, int argc, char** argv, int std
         goto fail;
     }
 
+    metrics.loadMs = wasm_run_lap(&lapTime);
+
     std::cout << "WasmRunnerImpl: host " << host << std::endl;
 
     wasm_runtime_set_wasi_args_ex(shared.module,
@@ -162,6 +228,13 @@ int WasmRunnerImpl::exec(const std::string& path, int argc, char** argv, int std
         goto fail;
     }
 
+    metrics.instantiateMs = wasm_run_lap(&lapTime);
+
+    // Not counting the time spent waiting for the debugger to attach
+    std::cout << "Time to first instruction: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count() / 1000.0
+              << "ms (" << (warm ? "warm" : "cold") << " runtime)" << std::endl;
+
     if (debug) {
         debug_exec_env = wasm_runtime_get_exec_env_singleton(shared.module_inst);
         debug_port = wasm_runtime_start_debug_instance(debug_exec_env);
@@ -169,7 +242,21 @@ int WasmRunnerImpl::exec(const std::string& path, int argc, char** argv, int std
         wasm_runtime_wait_for_remote_start(debug_exec_env);
     }
 
-    if (!wasm_application_execute_main(shared.module_inst, 0, NULL)) {
+    monitor = std::make_unique<WasmRunMonitor>(shared.module_inst, wasm_runtime_get_exec_env_singleton(shared.module_inst));
+    monitor->start();
+    wasm_run_lap(&lapTime);
+
+    executed = wasm_application_execute_main(shared.module_inst, 0, NULL);
+
+    metrics.mainMs = wasm_run_lap(&lapTime);
+    monitor->stop();
+    metrics.peakMemory = monitor->peakMemory();
+    metrics.pagesGrown = monitor->pagesGrown();
+    metrics.threadCount = monitor->peakThreads();
+    monitor.reset();
+    hostInterface->reportMetrics(metrics);
+
+    if (!executed) {
         if (!shared.killing) {
             const auto reason = std::string(wasm_runtime_get_exception(shared.module_inst));
             const auto err = "Uncaught exception: " + reason;
@@ -201,8 +288,15 @@ fail:
         wasm_runtime_unload(shared.module);
         shared.module = nullptr;
     }
+
+    // Referred to by the module until it is unloaded
+    wasm_module_buffer_close(&buffer);
+    if (threadEnv) {
+        wasm_runtime_destroy_thread_env();
+        threadEnv = false;
+    }
     if (shared.initialized) {
-        wasm_runtime_destroy();
+        release_wamr_runtime();
         shared.initialized = false;
     }
 
@@ -211,9 +305,10 @@ fail:
 
 void WasmRunnerImpl::destroy()
 {
+    // The runtime itself stays around for the next run
     std::lock_guard<std::mutex> lock(shared.runtimeMutex);
     if (shared.initialized) {
-        wasm_runtime_destroy();
+        release_wamr_runtime();
         shared.initialized = false;
     }
 }
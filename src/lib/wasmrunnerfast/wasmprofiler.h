@@ -0,0 +1,191 @@
+#ifndef WASMPROFILER_H
+#define WASMPROFILER_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include <wasm_export.h>
+
+#include "wasm_exec_env.h"
+#include "wasm_interp.h"
+#include "wasm_runtime.h"
+
+// Samples the interpreter's call stack of a running exec env from a thread of its own.
+// The stack is walked while the guest keeps running, so every frame and function
+// is checked against the exec env's stack and the instance's functions before use.
+// Only the thread running main() is sampled, threads spawned by the guest are not.
+class WasmProfiler
+{
+public:
+    static constexpr std::chrono::microseconds SampleInterval{1000};
+    static constexpr size_t MaxDepth = 256;
+
+    WasmProfiler(wasm_module_inst_t moduleInst, wasm_exec_env_t execEnv) :
+        m_moduleInst((WASMModuleInstance*)moduleInst), m_execEnv((WASMExecEnv*)execEnv) {}
+
+    ~WasmProfiler()
+    {
+        stop();
+    }
+
+    void start()
+    {
+        m_running = true;
+        m_sampler = std::thread([this]() {
+            while (m_running) {
+                std::this_thread::sleep_for(SampleInterval);
+                sample();
+            }
+        });
+    }
+
+    void stop()
+    {
+        m_running = false;
+        if (m_sampler.joinable())
+            m_sampler.join();
+    }
+
+    // Prints the hottest functions to fd and writes all stacks in the folded format
+    // flamegraph.pl, inferno and speedscope take.
+    void report(const std::string& foldedPath, const int fd)
+    {
+        std::map<uint32_t, uint64_t> self;
+        std::map<uint32_t, uint64_t> total;
+        uint64_t samples = 0;
+
+        std::ofstream folded(foldedPath, std::ios::trunc);
+        for (const auto& [stack, count] : m_stacks) {
+            samples += count;
+            self[stack.back()] += count;
+
+            // Recursive functions count once per sample towards their total
+            const std::set<uint32_t> functions(stack.begin(), stack.end());
+            for (const auto function : functions)
+                total[function] += count;
+
+            if (!folded.is_open())
+                continue;
+
+            for (size_t i = 0; i < stack.size(); i++)
+                folded << (i > 0 ? ";" : "") << foldedName(stack[i]);
+            folded << " " << count << "\n";
+        }
+
+        std::vector<std::pair<uint32_t, uint64_t>> hottest(self.begin(), self.end());
+        std::sort(hottest.begin(), hottest.end(), [](const auto& a, const auto& b) {
+            return a.second > b.second;
+        });
+
+        const double msPerSample = SampleInterval.count() / 1000.0;
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(1);
+        out << "\nProfile: " << samples << " samples, " << samples * msPerSample << " ms\n";
+        out << std::setw(10) << "self ms" << std::setw(8) << "self%"
+            << std::setw(10) << "total ms" << std::setw(8) << "total%" << "  function\n";
+
+        const size_t shown = std::min<size_t>(hottest.size(), 25);
+        for (size_t i = 0; i < shown; i++) {
+            const auto function = hottest[i].first;
+            const auto selfSamples = hottest[i].second;
+            const auto totalSamples = total[function];
+            out << std::setw(10) << selfSamples * msPerSample
+                << std::setw(7) << (samples ? 100.0 * selfSamples / samples : 0.0) << "%"
+                << std::setw(10) << totalSamples * msPerSample
+                << std::setw(7) << (samples ? 100.0 * totalSamples / samples : 0.0) << "%"
+                << "  " << functionName(function) << "\n";
+        }
+
+        if (folded.is_open())
+            out << "Folded stacks written to " << foldedPath << "\n";
+        else
+            out << "Failed to write folded stacks to " << foldedPath << "\n";
+
+        const auto text = out.str();
+        if (write(fd, text.data(), text.size()) < 0)
+            perror("Failed to print profile");
+    }
+
+private:
+    void sample()
+    {
+        const uint8_t* bottom = m_execEnv->wasm_stack.s.bottom;
+        const uint8_t* top = m_execEnv->wasm_stack.s.top_boundary;
+        const WASMFunctionInstance* functions = m_moduleInst->e->functions;
+        const uint32_t functionCount = m_moduleInst->e->function_count;
+
+        std::vector<uint32_t> stack;
+        const WASMInterpFrame* frame = m_execEnv->cur_frame;
+        while (frame && stack.size() < MaxDepth) {
+            if ((const uint8_t*)frame < bottom || (const uint8_t*)frame >= top)
+                return;
+
+            // Frames of native callers carry no function
+            const WASMFunctionInstance* function = frame->function;
+            if (function) {
+                if (function < functions || function >= functions + functionCount)
+                    return;
+                stack.push_back((uint32_t)(function - functions));
+            }
+            frame = frame->prev_frame;
+        }
+
+        if (stack.empty())
+            return;
+
+        // Root first, the way folded stacks are written
+        std::reverse(stack.begin(), stack.end());
+        m_stacks[stack]++;
+    }
+
+    // Prefers the name section, falling back to import and export names
+    std::string functionName(const uint32_t index) const
+    {
+        const WASMFunctionInstance& function = m_moduleInst->e->functions[index];
+        if (function.is_import_func) {
+            return std::string(function.u.func_import->module_name) + "." +
+                   function.u.func_import->field_name;
+        }
+
+#if WASM_ENABLE_CUSTOM_NAME_SECTION != 0
+        if (function.u.func->field_name)
+            return function.u.func->field_name;
+#endif
+
+        for (uint32_t i = 0; i < m_moduleInst->export_func_count; i++) {
+            if (m_moduleInst->export_functions[i].function == &function)
+                return m_moduleInst->export_functions[i].name;
+        }
+
+        return "func[" + std::to_string(index) + "]";
+    }
+
+    // Separators of the folded format can't be part of a frame
+    std::string foldedName(const uint32_t index) const
+    {
+        auto name = functionName(index);
+        std::replace(name.begin(), name.end(), ';', ':');
+        std::replace(name.begin(), name.end(), ' ', '_');
+        return name;
+    }
+
+    WASMModuleInstance* m_moduleInst;
+    WASMExecEnv* m_execEnv;
+    std::atomic<bool> m_running{false};
+    std::thread m_sampler;
+    std::map<std::vector<uint32_t>, uint64_t> m_stacks;
+};
+
+#endif // WASMPROFILER_H
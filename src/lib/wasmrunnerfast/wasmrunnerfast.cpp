@@ -16,6 +16,7 @@
 
 #include <pthread.h>
 #include <stdint.h>
+#include <chrono>
 #include <memory>
 #include <vector>
 #include <string>
@@ -23,7 +24,12 @@
 #include <wasm_c_api.h>
 #include <wasm_export.h>
 
+#include "common/wasmmemorypool.h"
+#include "common/wasmmodulecache.h"
 #include "common/wasmrunnerinterface.h"
+#include "common/wasmrunmonitor.h"
+
+#include "wasmprofiler.h"
 
 #include "bh_read_file.h"
 
@@ -47,32 +53,117 @@ struct WasmRunnerFastImplSharedData {
     wasm_exec_env_t exec_env = nullptr;
     bool killing;
     bool killed;
-    bool initialized;
+    bool initialized = false;
     WasmRunnerConfig configuration;
 
-    // Why a std::vector of characters here?
-    //
-    // As per it's documentation on docs.qt.io, the use of QByteArrays
-    // would result in a zero-terminated ('\0') chunk of memory,
-    // meaning the last character in the the array would always be '\0'.
-    //
-    // This would result in memory being easily passable as C-style strings
-    // (so classic char*) to C functions which would expect strings, which would easily
-    // make an attached debugger or malicious actor allow for inspection of memory
-    // quite easily, because at that point everything treats it as a C-style string.
-    // This would allow for easy print-out using printf() functions, modification
-    // using respective string modification facilities, and so forth.
-    //
-    // This is bad for security and the expectations one would expect from
-    // a sandboxed environment, meaning strict separation between host and guest.
-    //
-    // std::vector<char> however as per it's own documentation also provides contiguous memory,
-    // while not adding the same zero-terminator at the end of the memory.
-    std::vector<unsigned char> pool;
-
     std::mutex runtimeMutex;
 };
 
+// The runtime is initialized once per process and kept warm between runs,
+// only modules and their instances are created and destroyed per exec().
+// It is set up again only if no run is in flight and the thread limit or allocator changed.
+struct WasmRunnerFastRuntime {
+    std::mutex mutex;
+    bool initialized = false;
+    unsigned int threadCount = 0;
+    size_t poolSize = 0;
+    unsigned int users = 0;
+};
+
+static WasmRunnerFastRuntime runtime;
+
+// Outlives the module cache, cached modules are allocated from it
+static WasmMemoryPool memoryPool;
+
+// Modules of earlier runs, unchanged binaries skip reading and validation
+static constexpr size_t ModuleCacheCapacity = 256 * 1024 * 1024;
+// The fast interpreter rewrites function bodies into its own, larger bytecode
+static constexpr unsigned int ModuleLoadFactor = 3;
+static WasmModuleCache moduleCache(ModuleCacheCapacity, ModuleLoadFactor);
+
+// Loader, instance and linear memory data on top of the guest heap and native stacks
+static constexpr size_t PoolOverhead = 128 * 1024 * 1024;
+static constexpr size_t PoolModuleCacheCapacity = 32 * 1024 * 1024;
+
+// Zero for the system allocator
+static size_t wamr_pool_size(const WasmRunnerConfig& config)
+{
+    if (!(config.flags & WasmRunnerConfigFlags::Pool))
+        return 0;
+
+    const size_t size = (size_t)config.heapSize +
+                        (size_t)config.stackSize * (config.threadCount + 1) +
+                        PoolOverhead;
+
+    // WAMR takes the pool size as 32 bit value
+    if (size > UINT32_MAX) {
+        std::cout << "Memory pool too large, using the system allocator" << std::endl;
+        return 0;
+    }
+    return size;
+}
+
+static bool acquire_wamr_runtime(const WasmRunnerConfig& config, bool* warm)
+{
+    std::lock_guard<std::mutex> lock(runtime.mutex);
+
+    auto poolSize = wamr_pool_size(config);
+    *warm = runtime.initialized &&
+            ((runtime.threadCount == config.threadCount && runtime.poolSize == poolSize) ||
+             runtime.users > 0);
+    if (*warm) {
+        runtime.users++;
+        return true;
+    }
+
+    if (runtime.initialized) {
+        moduleCache.clear();
+        wasm_runtime_destroy();
+        runtime.initialized = false;
+    }
+
+    RuntimeInitArgs init_args;
+    memset(&init_args, 0, sizeof(RuntimeInitArgs));
+
+    if (poolSize > 0 && !memoryPool.reserve(poolSize, true))
+        poolSize = 0;
+
+    if (poolSize > 0) {
+        init_args.mem_alloc_type = Alloc_With_Pool;
+        init_args.mem_alloc_option.pool.heap_buf = memoryPool.data();
+        init_args.mem_alloc_option.pool.heap_size = memoryPool.size();
+    } else {
+        init_args.mem_alloc_type = Alloc_With_System_Allocator;
+    }
+    init_args.max_thread_num = config.threadCount;
+    init_args.running_mode = Mode_Interp;
+
+    if (!wasm_runtime_full_init(&init_args))
+        return false;
+
+    // Register native API bindings
+    //register_wamr_opengles_bindings();
+    //register_wamr_tideui_bindings();
+    //register_wamr_sdl2_bindings();
+
+    // Cached modules would otherwise eat up the pool meant for guests
+    moduleCache.setCapacity(poolSize > 0 ? PoolModuleCacheCapacity : ModuleCacheCapacity);
+
+    runtime.initialized = true;
+    runtime.threadCount = config.threadCount;
+    // The request rather than the outcome, a pool that failed to map isn't retried every run
+    runtime.poolSize = wamr_pool_size(config);
+    runtime.users++;
+    return true;
+}
+
+static void release_wamr_runtime()
+{
+    std::lock_guard<std::mutex> lock(runtime.mutex);
+    if (runtime.users > 0)
+        runtime.users--;
+}
+
 class WasmRunnerFastImpl : public WasmRunnerInterface
 {
 public:
@@ -104,52 +195,10 @@ void WasmRunnerFastImpl::init(const WasmRunnerConfig& config)
     std::cout << "Thread count:" << config.threadCount << std::endl;
     std::cout << "Flags:" << config.flags << std::endl;
 
-    //shared.pool.resize(config.heapSize + config.stackSize);
-    //shared.pool.shrink_to_fit();
-
     // Prepare config for runtime initialization to properly take place
     shared.configuration = config;
 }
 
-void* mmap_wamr_file(const char* filename, unsigned int* size, int* fd)
-{
-    int file;
-    uint32 file_size, buf_size, read_size;
-    struct stat stat_buf;
-
-    if (!filename || !size || !fd) {
-        printf("Read file to buffer failed: invalid filename, ret size or fd.\n");
-        return nullptr;
-    }
-
-    if ((file = open(filename, O_RDONLY, 0)) == -1) {
-        printf("Read file to buffer failed: open file %s failed.\n", filename);
-        return nullptr;
-    }
-
-    if (fstat(file, &stat_buf) != 0) {
-        printf("Read file to buffer failed: fstat file %s failed.\n", filename);
-        close(file);
-        return nullptr;
-    }
-
-    file_size = (uint32)stat_buf.st_size;
-    if (file_size == 0) {
-        close(file);
-        return nullptr;
-    }
-
-    void* ret = mmap(NULL, file_size, PROT_READ | PROT_EXEC, MAP_PRIVATE, file, 0);
-    if (!ret) {
-        close(file);
-        return nullptr;
-    }
-
-    *size = file_size;
-    *fd = file;
-    return ret;
-}
-
 int WasmRunnerFastImpl::exec(const std::string& path, int argc, char** argv, int stdinfd, int stdoutfd, int stderrfd, const bool debug, const std::string& readableDir)
 {
     char error_buf[128];
@@ -162,11 +211,17 @@ int WasmRunnerFastImpl::exec(const std::string& path, int argc, char** argv, int
     std::vector<const char*> env;
     std::string exepath = path;
     int exitCode = -1;
-    bool useMmap = false;
-    unsigned int siz = 0;
-    uint8_t* buf = nullptr;
-    int fd = -1;
-    RuntimeInitArgs init_args;
+    const bool useMmap = (shared.configuration.flags & WasmRunnerConfigFlags::Mmap);
+    const bool useModuleCache = !(shared.configuration.flags & WasmRunnerConfigFlags::NoModuleCache);
+    bool warm = false;
+    bool threadEnv = false;
+    std::shared_ptr<WasmModuleCache::Entry> cachedModule;
+    std::unique_ptr<WasmProfiler> profiler;
+    bool executed = false;
+    WasmRunMetrics metrics;
+    std::unique_ptr<WasmRunMonitor> monitor;
+    const auto startTime = std::chrono::steady_clock::now();
+    auto lapTime = startTime;
 
     std::lock_guard<std::mutex> lock(shared.runtimeMutex);
 
@@ -181,47 +236,34 @@ int WasmRunnerFastImpl::exec(const std::string& path, int argc, char** argv, int
         goto fail;
     }
 
-    // Register native API bindings
-    //register_wamr_opengles_bindings();
-    //register_wamr_tideui_bindings();
-    //register_wamr_sdl2_bindings();
-
-    memset(&init_args, 0, sizeof(RuntimeInitArgs));
-
-    init_args.mem_alloc_type = Alloc_With_System_Allocator;
-    //init_args.mem_alloc_option.pool.heap_buf = shared.pool.data();
-    //init_args.mem_alloc_option.pool.heap_size = shared.pool.capacity();
-    init_args.max_thread_num = shared.configuration.threadCount;
-    init_args.running_mode = Mode_Interp;
-
-    if (!wasm_runtime_full_init(&init_args)) {
+    if (!acquire_wamr_runtime(shared.configuration, &warm)) {
         shared.host->reportError("Failed to initialize WASM runtime");
         goto fail;
     }
 
     shared.initialized = true;
 
+    // Every run gets a thread of its own, not necessarily the one that initialized the runtime
+    if (!wasm_runtime_thread_env_inited()) {
+        if (!wasm_runtime_init_thread_env()) {
+            shared.host->reportError("Failed to initialize WASM thread environment");
+            goto fail;
+        }
+        threadEnv = true;
+    }
+
     std::cout << "Loading wasm: " << path << std::endl;
     for (int i = 0; i < argc; i++) {
         std::cout << "arg: " << argv[i] << std::endl;
     }
 
-    if (!useMmap) {
-        siz = 0;
-        buf = (uint8_t*)bh_read_file_to_buffer(path.c_str(), &siz);
-    } else {
-        fd = -1;
-        siz = 0;
-        buf = (uint8_t*)mmap_wamr_file(exepath.c_str(), &siz, &fd);
-        if (!buf) {
-            std::string reason; reason = std::string(error_buf);
-            std::string err; err = "Failed to read file: " + exepath;
-            hostInterface->reportError(err);
-            goto fail;
-        }
-    }
+    // Reuses the module of an earlier run if the binary didn't change
+    wasm_run_lap(&lapTime);
+    cachedModule = moduleCache.acquire(exepath, useMmap, useModuleCache, error_buf, sizeof(error_buf));
+    if (cachedModule)
+        shared.module = cachedModule->module;
+    metrics.loadMs = wasm_run_lap(&lapTime);
 
-    shared.module = wasm_runtime_load(buf, siz, error_buf, sizeof(error_buf));
     if (!shared.module) {
         std::string reason; reason = std::string(error_buf);
         std::string err; err = "Failed to load wasm module: " + reason;
@@ -262,7 +304,40 @@ int WasmRunnerFastImpl::exec(const std::string& path, int argc, char** argv, int
         goto fail;
     }
 
-    if (!wasm_application_execute_main(shared.module_inst, 0, NULL)) {
+    metrics.instantiateMs = wasm_run_lap(&lapTime);
+
+    std::cout << "Time to first instruction: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count() / 1000.0
+              << "ms (" << (warm ? "warm" : "cold") << " runtime)" << std::endl;
+
+    if (shared.configuration.flags & WasmRunnerConfigFlags::Profile) {
+        // main() runs in the instance's singleton exec env rather than the one created above
+        profiler = std::make_unique<WasmProfiler>(shared.module_inst, wasm_runtime_get_exec_env_singleton(shared.module_inst));
+        profiler->start();
+    }
+
+    monitor = std::make_unique<WasmRunMonitor>(shared.module_inst, wasm_runtime_get_exec_env_singleton(shared.module_inst));
+    monitor->start();
+    wasm_run_lap(&lapTime);
+
+    executed = wasm_application_execute_main(shared.module_inst, 0, NULL);
+
+    metrics.mainMs = wasm_run_lap(&lapTime);
+    monitor->stop();
+    metrics.peakMemory = monitor->peakMemory();
+    metrics.pagesGrown = monitor->pagesGrown();
+    metrics.threadCount = monitor->peakThreads();
+    monitor.reset();
+    hostInterface->reportMetrics(metrics);
+
+    // Printed ahead of the exit being reported so it ends up in the console
+    if (profiler) {
+        profiler->stop();
+        profiler->report(exepath + ".folded", stdoutfd);
+        profiler.reset();
+    }
+
+    if (!executed) {
         if (!shared.killing) {
             const auto reason = std::string(wasm_runtime_get_exception(shared.module_inst));
             const auto err = "Uncaught exception: " + reason;
@@ -282,22 +357,6 @@ fail:
     // Whether killed or not, we can reset state here
     shared.killing = false;
 
-    if (!useMmap) {
-        if (buf) {
-            BH_FREE(buf);
-            buf = nullptr;
-        }
-    } else {
-        if (buf) {
-            munmap(buf, siz);
-            buf = nullptr;
-        }
-        if (fd >= 0) {
-            close(fd);
-            fd = -1;
-        }
-    }
-
     if (shared.exec_env) {
         wasm_runtime_destroy_exec_env(shared.exec_env);
         shared.exec_env = nullptr;
@@ -306,29 +365,30 @@ fail:
         wasm_runtime_deinstantiate(shared.module_inst);
         shared.module_inst = nullptr;
     }
-    if (shared.module) {
-        wasm_runtime_unload(shared.module);
+    if (cachedModule) {
+        // Stays loaded for the next run
         shared.module = nullptr;
+        moduleCache.release(cachedModule);
+        cachedModule.reset();
+    }
+    if (threadEnv) {
+        wasm_runtime_destroy_thread_env();
+        threadEnv = false;
     }
     if (shared.initialized) {
-        wasm_runtime_destroy();
+        release_wamr_runtime();
         shared.initialized = false;
     }
 
-
-    // Execution finished, pool not needed anymore
-    shared.pool.clear();
-    shared.pool.resize(0);
-    shared.pool.shrink_to_fit();
-
     return exitCode;
 }
 
 void WasmRunnerFastImpl::destroy()
 {
+    // The runtime itself stays around for the next run
     std::lock_guard<std::mutex> lock(shared.runtimeMutex);
     if (shared.initialized) {
-        wasm_runtime_destroy();
+        release_wamr_runtime();
         shared.initialized = false;
     }
 }
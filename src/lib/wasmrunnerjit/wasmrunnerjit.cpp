@@ -16,14 +16,21 @@
 
 #include <pthread.h>
 #include <stdint.h>
+#include <chrono>
 #include <memory>
+#include <set>
+#include <sstream>
+#include <thread>
 #include <vector>
 #include <string>
 
 #include <wasm_c_api.h>
 #include <wasm_export.h>
 
+#include "common/wasmmemorypool.h"
+#include "common/wasmmodulecache.h"
 #include "common/wasmrunnerinterface.h"
+#include "common/wasmrunmonitor.h"
 
 #include "bh_read_file.h"
 
@@ -38,11 +45,18 @@
 #define SUPPORTS_AOT 0
 #endif
 #else
-#define SUPPORTS_AOT 0
+#define SUPPORTS_AOT 1
 #endif
 
 #if SUPPORTS_AOT
 #include "aot_export.h"
+#include <llvm-c/TargetMachine.h>
+#endif
+
+#define SUPPORTS_TIERING (WASM_ENABLE_FAST_JIT != 0 && WASM_ENABLE_JIT != 0 && WASM_ENABLE_LAZY_JIT != 0)
+
+#if SUPPORTS_TIERING
+#include "wasm.h"
 #endif
 
 struct WasmRunnerJITImplSharedData {
@@ -55,96 +69,343 @@ struct WasmRunnerJITImplSharedData {
     wasm_exec_env_t exec_env = nullptr;
     bool killing;
     bool killed;
+    bool initialized = false;
     WasmRunnerConfig configuration;
     std::mutex runtimeMutex;
 };
 
-class WasmRunnerJITImpl : public WasmRunnerInterface
+// The runtime is initialized once per process and kept warm between runs,
+// only modules and their instances are created and destroyed per exec().
+// It is set up again only if no run is in flight and the thread limit,
+// running mode or allocator changed.
+struct WasmRunnerJITRuntime {
+    std::mutex mutex;
+    bool initialized = false;
+    unsigned int threadCount = 0;
+    RunningMode runningMode = Mode_LLVM_JIT;
+    size_t poolSize = 0;
+    unsigned int users = 0;
+};
+
+static WasmRunnerJITRuntime runtime;
+
+// Tiered runs start in the fast JIT while LLVM compiles every function in the
+// background, calls switch over to the optimized code as it becomes available
+static RunningMode wamr_running_mode(const WasmRunnerConfig& config)
 {
-public:
-    WasmRunnerJITImpl(WasmRuntimeHost host);
-    virtual void init(const WasmRunnerConfig& config) override;
-    virtual void destroy() override;
-    virtual int exec(const std::string& path, int argc, char** argv, int infd, int outfd, int errfd, const bool debug, const std::string& readableDir) override;
-    virtual void stop() override;
+    if ((config.flags & WasmRunnerConfigFlags::Tiered) &&
+        wasm_runtime_is_running_mode_supported(Mode_Multi_Tier_JIT))
+        return Mode_Multi_Tier_JIT;
+    return Mode_LLVM_JIT;
+}
 
-private:
-    WasmRunnerJITImplSharedData shared;
-};
+// Outlives the module cache, cached modules are allocated from it
+static WasmMemoryPool memoryPool;
 
+// Modules of earlier runs, unchanged binaries skip reading and validation
+static constexpr size_t ModuleCacheCapacity = 256 * 1024 * 1024;
+// Compiled machine code and the JIT's own data weigh several times the bytecode
+static constexpr unsigned int ModuleLoadFactor = 8;
+static WasmModuleCache moduleCache(ModuleCacheCapacity, ModuleLoadFactor);
 
-WasmRunnerJITImpl::WasmRunnerJITImpl(WasmRuntimeHost host) :
-    WasmRunnerInterface(host)
+// Loader, instance and linear memory data on top of the guest heap and native stacks
+static constexpr size_t PoolOverhead = 128 * 1024 * 1024;
+static constexpr size_t PoolModuleCacheCapacity = 32 * 1024 * 1024;
+
+// Zero for the system allocator
+static size_t wamr_pool_size(const WasmRunnerConfig& config)
 {
+    if (!(config.flags & WasmRunnerConfigFlags::Pool))
+        return 0;
+
+    const size_t size = (size_t)config.heapSize +
+                        (size_t)config.stackSize * (config.threadCount + 1) +
+                        PoolOverhead;
+
+    // WAMR takes the pool size as 32 bit value
+    if (size > UINT32_MAX) {
+        std::cout << "Memory pool too large, using the system allocator" << std::endl;
+        return 0;
+    }
+    return size;
 }
 
-void WasmRunnerJITImpl::init(const WasmRunnerConfig& config)
+static bool acquire_wamr_runtime(const WasmRunnerConfig& config, bool* warm)
 {
-    std::cout << "Configuring:" << std::endl;
-    std::cout << "Stack size: " << config.stackSize << std::endl;
-    std::cout << "Heap size:" << config.heapSize << std::endl;
-    std::cout << "Thread count:" << config.threadCount << std::endl;
+    std::lock_guard<std::mutex> lock(runtime.mutex);
+
+    const auto runningMode = wamr_running_mode(config);
+    auto poolSize = wamr_pool_size(config);
+    *warm = runtime.initialized &&
+            ((runtime.threadCount == config.threadCount && runtime.runningMode == runningMode &&
+              runtime.poolSize == poolSize) ||
+             runtime.users > 0);
+    if (*warm) {
+        runtime.users++;
+        return true;
+    }
 
-    shared.configuration = config;
+    if (runtime.initialized) {
+        moduleCache.clear();
+        wasm_runtime_destroy();
+        runtime.initialized = false;
+    }
 
     RuntimeInitArgs init_args;
     memset(&init_args, 0, sizeof(RuntimeInitArgs));
 
-    init_args.mem_alloc_type = Alloc_With_System_Allocator;
+    if (poolSize > 0 && !memoryPool.reserve(poolSize, true))
+        poolSize = 0;
+
+    if (poolSize > 0) {
+        init_args.mem_alloc_type = Alloc_With_Pool;
+        init_args.mem_alloc_option.pool.heap_buf = memoryPool.data();
+        init_args.mem_alloc_option.pool.heap_size = memoryPool.size();
+    } else {
+        init_args.mem_alloc_type = Alloc_With_System_Allocator;
+    }
     init_args.max_thread_num = config.threadCount;
     init_args.llvm_jit_opt_level = 3;
     init_args.llvm_jit_size_level = 3;
-    init_args.running_mode = Mode_LLVM_JIT;
+    init_args.running_mode = runningMode;
 
-    wasm_runtime_full_init(&init_args);
+    if (!wasm_runtime_full_init(&init_args))
+        return false;
 
     // Register native API bindings
     //register_wamr_opengles_bindings();
     //register_wamr_tideui_bindings();
     //register_wamr_sdl2_bindings();
 
-    shared.host = (WasmRunnerHost*)host;
+    // Cached modules would otherwise eat up the pool meant for guests
+    moduleCache.setCapacity(poolSize > 0 ? PoolModuleCacheCapacity : ModuleCacheCapacity);
+
+    runtime.initialized = true;
+    runtime.threadCount = config.threadCount;
+    runtime.runningMode = runningMode;
+    // The request rather than the outcome, a pool that failed to map isn't retried every run
+    runtime.poolSize = wamr_pool_size(config);
+    runtime.users++;
+    return true;
 }
 
-void* mmap_wamr_file(const char* filename, unsigned int* size, int* fd)
+static void release_wamr_runtime()
 {
-    int file;
-    uint32 file_size, buf_size, read_size;
-    struct stat stat_buf;
+    std::lock_guard<std::mutex> lock(runtime.mutex);
+    if (runtime.users > 0)
+        runtime.users--;
+}
 
-    if (!filename || !size || !fd) {
-        printf("Read file to buffer failed: invalid filename, ret size or fd.\n");
-        return nullptr;
+#if SUPPORTS_AOT
+// Bump whenever the AOT compile options in compile_aot() change
+static constexpr int AotCacheVersion = 1;
+
+// Compiled code is only valid for the binary it was compiled from
+// and the CPU it was compiled for, stored next to the .aot file
+static std::string aot_cache_key(const std::string& wasmPath)
+{
+    WasmModuleBuffer buffer;
+    if (!wasm_module_buffer_open(wasmPath, true, &buffer))
+        return std::string();
+
+    const auto wasmHash = wasm_module_buffer_hash(buffer.data, buffer.size);
+    wasm_module_buffer_close(&buffer);
+
+    char* cpuName = LLVMGetHostCPUName();
+    char* cpuFeatures = LLVMGetHostCPUFeatures();
+
+    std::ostringstream key;
+    key << AotCacheVersion << " " << std::hex << wasmHash << " " << cpuName << " " << cpuFeatures;
+
+    LLVMDisposeMessage(cpuName);
+    LLVMDisposeMessage(cpuFeatures);
+    return key.str();
+}
+
+static std::string read_aot_cache_key(const std::string& keyPath)
+{
+    std::string ret;
+    std::ifstream keyFile(keyPath);
+    std::getline(keyFile, ret);
+    return ret;
+}
+
+static bool write_aot_cache_key(const std::string& keyPath, const std::string& key)
+{
+    std::ofstream keyFile(keyPath, std::ios::trunc);
+    keyFile << key << std::endl;
+    return keyFile.good();
+}
+
+static bool compile_aot(const std::string& wasmPath, const std::string& aotPath)
+{
+    char error_buf[128];
+    bool ret = false;
+    WasmModuleBuffer buffer;
+    wasm_module_t wasm_module = nullptr;
+    aot_comp_data_t comp_data = nullptr;
+    aot_comp_context_t comp_ctx = nullptr;
+    const auto tmpPath = aotPath + ".tmp";
+    const auto startTime = std::chrono::steady_clock::now();
+
+    // No target given, so LLVM compiles for the host CPU and its features.
+    // Options have to match what the runtime was built with.
+    AOTCompOption option;
+    memset(&option, 0, sizeof(AOTCompOption));
+    option.opt_level = 3;
+    option.size_level = 3;
+    option.output_format = AOT_FORMAT_FILE;
+    option.bounds_checks = 1; // Built without hardware bounds checks
+    option.stack_bounds_checks = 0;
+    option.enable_simd = true;
+    option.enable_aux_stack_check = true;
+    option.enable_bulk_memory = true;
+    option.enable_thread_mgr = true;
+    option.enable_ref_types = false;
+    option.enable_tail_call = true;
+
+    if (!wasm_module_buffer_open(wasmPath, false, &buffer)) {
+        std::cout << "Failed to read " << wasmPath << std::endl;
+        goto fail;
     }
 
-    if ((file = open(filename, O_RDONLY, 0)) == -1) {
-        printf("Read file to buffer failed: open file %s failed.\n", filename);
-        return nullptr;
+    if (!(wasm_module = wasm_runtime_load(buffer.data, buffer.size, error_buf, sizeof(error_buf)))) {
+        std::cout << error_buf << std::endl;
+        goto fail;
     }
 
-    if (fstat(file, &stat_buf) != 0) {
-        printf("Read file to buffer failed: fstat file %s failed.\n", filename);
-        close(file);
-        return nullptr;
+    if (!(comp_data = aot_create_comp_data(wasm_module))) {
+        std::cout << aot_get_last_error() << std::endl;
+        goto fail;
     }
 
-    file_size = (uint32)stat_buf.st_size;
-    if (file_size == 0) {
-        close(file);
-        return nullptr;
+    if (!(comp_ctx = aot_create_comp_context(comp_data, &option))) {
+        std::cout << aot_get_last_error() << std::endl;
+        goto fail;
     }
 
-    void* ret = mmap(NULL, file_size, PROT_READ | PROT_EXEC, MAP_PRIVATE, file, 0);
-    if (!ret) {
-        close(file);
-        return nullptr;
+    if (!aot_compile_wasm(comp_ctx)) {
+        std::cout << aot_get_last_error() << std::endl;
+        goto fail;
+    }
+
+    // Written aside first, a run must never pick up a partially written file
+    if (!aot_emit_aot_file(comp_ctx, comp_data, tmpPath.c_str())) {
+        std::cout << aot_get_last_error() << std::endl;
+        goto fail;
     }
 
-    *size = file_size;
-    *fd = file;
+    ret = (rename(tmpPath.c_str(), aotPath.c_str()) == 0);
+    std::cout << "AOT compilation of " << wasmPath << " took "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count()
+              << "ms" << std::endl;
+
+fail:
+    if (comp_ctx)
+        aot_destroy_comp_context(comp_ctx);
+    if (comp_data)
+        aot_destroy_comp_data(comp_data);
+    if (wasm_module)
+        wasm_runtime_unload(wasm_module);
+    wasm_module_buffer_close(&buffer);
+
+    if (!ret)
+        unlink(tmpPath.c_str());
+
     return ret;
 }
 
+static std::mutex aotCompilingMutex;
+static std::set<std::string> aotCompiling;
+
+// Lets the current run go on in the tiered JIT, the next run picks up the AOT code
+static void compile_aot_async(const std::string& wasmPath, const std::string& aotPath,
+                              const std::string& keyPath, const std::string& key,
+                              const WasmRunnerConfig& config)
+{
+    {
+        std::lock_guard<std::mutex> lock(aotCompilingMutex);
+        if (!aotCompiling.insert(aotPath).second)
+            return;
+    }
+
+    bool warm = false;
+    if (!acquire_wamr_runtime(config, &warm)) {
+        std::lock_guard<std::mutex> lock(aotCompilingMutex);
+        aotCompiling.erase(aotPath);
+        return;
+    }
+
+    std::thread compileThread([=]() {
+        const bool threadEnv = !wasm_runtime_thread_env_inited() && wasm_runtime_init_thread_env();
+
+        if (!compile_aot(wasmPath, aotPath) || !write_aot_cache_key(keyPath, key))
+            unlink(keyPath.c_str());
+
+        if (threadEnv)
+            wasm_runtime_destroy_thread_env();
+        release_wamr_runtime();
+
+        std::lock_guard<std::mutex> lock(aotCompilingMutex);
+        aotCompiling.erase(aotPath);
+    });
+    compileThread.detach();
+}
+#endif
+
+#if SUPPORTS_TIERING
+// Functions LLVM has compiled so far, calls to those left the fast JIT tier
+static uint32_t promoted_functions(wasm_module_t module, uint32_t* total)
+{
+    *total = 0;
+    if (wasm_runtime_get_module_package_type(module) != Wasm_Module_Bytecode)
+        return 0;
+
+    const WASMModule* wasmModule = (const WASMModule*)module;
+    if (!wasmModule->func_ptrs_compiled)
+        return 0;
+
+    uint32_t ret = 0;
+    *total = wasmModule->function_count;
+    for (uint32_t i = 0; i < wasmModule->function_count; i++) {
+        if (wasmModule->func_ptrs_compiled[i])
+            ret++;
+    }
+    return ret;
+}
+#endif
+
+class WasmRunnerJITImpl : public WasmRunnerInterface
+{
+public:
+    WasmRunnerJITImpl(WasmRuntimeHost host);
+    virtual void init(const WasmRunnerConfig& config) override;
+    virtual void destroy() override;
+    virtual int exec(const std::string& path, int argc, char** argv, int infd, int outfd, int errfd, const bool debug, const std::string& readableDir) override;
+    virtual void stop() override;
+
+private:
+    WasmRunnerJITImplSharedData shared;
+};
+
+
+WasmRunnerJITImpl::WasmRunnerJITImpl(WasmRuntimeHost host) :
+    WasmRunnerInterface(host)
+{
+}
+
+void WasmRunnerJITImpl::init(const WasmRunnerConfig& config)
+{
+    std::cout << "Configuring:" << std::endl;
+    std::cout << "Stack size: " << config.stackSize << std::endl;
+    std::cout << "Heap size:" << config.heapSize << std::endl;
+    std::cout << "Thread count:" << config.threadCount << std::endl;
+
+    std::lock_guard<std::mutex> lock(shared.runtimeMutex);
+    shared.configuration = config;
+    shared.host = (WasmRunnerHost*)host;
+}
+
 int WasmRunnerJITImpl::exec(const std::string& path, int argc, char** argv, int stdinfd, int stdoutfd, int stderrfd, const bool debug, const std::string& readableDir)
 {
     char error_buf[128];
@@ -157,10 +418,16 @@ int WasmRunnerJITImpl::exec(const std::string& path, int argc, char** argv, int
     std::vector<const char*> env;
     std::string exepath = path;
     int exitCode = -1;
-    bool useMmap = false;
-    unsigned int siz = 0;
-    uint8_t* buf = nullptr;
-    int fd = -1;
+    bool useMmap = (shared.configuration.flags & WasmRunnerConfigFlags::Mmap);
+    const bool useModuleCache = !(shared.configuration.flags & WasmRunnerConfigFlags::NoModuleCache);
+    bool warm = false;
+    bool threadEnv = false;
+    std::shared_ptr<WasmModuleCache::Entry> cachedModule;
+    bool executed = false;
+    WasmRunMetrics metrics;
+    std::unique_ptr<WasmRunMonitor> monitor;
+    const auto startTime = std::chrono::steady_clock::now();
+    auto lapTime = startTime;
 
     std::lock_guard<std::mutex> lock(shared.runtimeMutex);
 
@@ -175,6 +442,22 @@ int WasmRunnerJITImpl::exec(const std::string& path, int argc, char** argv, int
         goto fail;
     }
 
+    if (!acquire_wamr_runtime(shared.configuration, &warm)) {
+        hostInterface->reportError("Failed to initialize WASM runtime");
+        goto fail;
+    }
+
+    shared.initialized = true;
+
+    // Every run gets a thread of its own, not necessarily the one that initialized the runtime
+    if (!wasm_runtime_thread_env_inited()) {
+        if (!wasm_runtime_init_thread_env()) {
+            hostInterface->reportError("Failed to initialize WASM thread environment");
+            goto fail;
+        }
+        threadEnv = true;
+    }
+
     std::cout << "Loading wasm: " << path << std::endl;
     for (int i = 0; i < argc; i++) {
         std::cout << "arg: " << argv[i] << std::endl;
@@ -182,95 +465,39 @@ int WasmRunnerJITImpl::exec(const std::string& path, int argc, char** argv, int
 
 #if SUPPORTS_AOT
     if (shared.configuration.flags & WasmRunnerConfigFlags::AOT) {
-        bool aotSuccess = false;
         const auto aotpath = path + ".aot";
-        hostInterface->report("Optimizing via AOT...");
-
-        AOTCompOption option = { 0 };
-        option.opt_level = 3;
-        option.size_level = 3;
-        option.output_format = AOT_FORMAT_FILE;
-        option.bounds_checks = 0;
-        option.stack_bounds_checks = 0;
-        option.enable_simd = true;
-        option.enable_aux_stack_check = true;
-        option.enable_bulk_memory = true;
-        option.enable_thread_mgr = true;
-        option.enable_ref_types = true;
-        option.enable_tail_call = true;
-        option.is_indirect_mode = true;
-        option.disable_llvm_intrinsics = true;
-
-        wasm_module_t wasm_module = NULL;
-        aot_comp_data_t comp_data = NULL;
-        aot_comp_context_t comp_ctx = NULL;
-        uint8 *wasm_file = NULL;
-        uint32 wasm_file_size;
-
-        wasm_file = (uint8 *)bh_read_file_to_buffer(exepath.c_str(), &wasm_file_size);
-
-        /* load WASM module */
-        if (!(wasm_module = wasm_runtime_load(wasm_file, wasm_file_size, error_buf,
-                                              sizeof(error_buf)))) {
-            printf("%s\n", error_buf);
-            goto aotFail;
-        }
-
-        if (!(comp_data = aot_create_comp_data(wasm_module))) {
-            printf("%s\n", aot_get_last_error());
-            goto aotFail;
-        }
-
-        if (!(comp_ctx = aot_create_comp_context(comp_data, &option))) {
-            printf("%s\n", aot_get_last_error());
-            goto aotFail;
+        const auto keypath = aotpath + ".key";
+        const auto key = aot_cache_key(path);
+
+        bool aotReady = !key.empty() && access(aotpath.c_str(), R_OK) == 0 &&
+                        read_aot_cache_key(keypath) == key;
+        if (aotReady) {
+            std::cout << "Using cached AOT code " << aotpath << std::endl;
+        } else if (!key.empty() && wamr_running_mode(shared.configuration) == Mode_Multi_Tier_JIT) {
+            std::cout << "Compiling AOT code in the background, running tiered meanwhile" << std::endl;
+            compile_aot_async(path, aotpath, keypath, key, shared.configuration);
+        } else if (!key.empty()) {
+            hostInterface->report("Optimizing via AOT...");
+            aotReady = compile_aot(path, aotpath) && write_aot_cache_key(keypath, key);
         }
 
-        if (aot_compile_wasm(comp_ctx)) {
-            std::cout << "Compiled, saving " << aotpath << std::endl;
-            aotSuccess = aot_emit_llvm_file(comp_ctx, aotpath.c_str());
-        } else {
-            std::cout << aot_get_last_error() << std::endl;
-        }
-
-aotFail:
-        if (wasm_file)
-            BH_FREE(wasm_file);
-        if (comp_ctx)
-            aot_destroy_comp_context(comp_ctx);
-        if (comp_data)
-            aot_destroy_comp_data(comp_data);
-        if (wasm_module)
-            wasm_runtime_unload(wasm_module);
-
-        if (!aotSuccess) {
-            std::string err; err = "AOT compilation failed";
-            hostInterface->reportError(err);
-            goto fail;
-        } else {
-            std::cout << "AOT compilation successful" << std::endl;
+        if (aotReady) {
             exepath = aotpath;
             useMmap = true;
+        } else if (wamr_running_mode(shared.configuration) != Mode_Multi_Tier_JIT) {
+            std::cout << "AOT compilation failed, falling back to JIT" << std::endl;
+            unlink(keypath.c_str());
         }
     }
 #endif
 
-    if (!useMmap) {
-        siz = 0;
-        buf = (uint8_t*)bh_read_file_to_buffer(path.c_str(), &siz);
-    } else {
-        fd = -1;
-        siz = 0;
-        buf = (uint8_t*)mmap_wamr_file(exepath.c_str(), &siz, &fd);
-        if (!buf) {
-            std::string reason; reason = std::string(error_buf);
-            std::string err; err = "Failed to read file: " + exepath;
-            hostInterface->reportError(err);
-            goto fail;
-        }
-    }
+    // Reuses the module of an earlier run if the binary didn't change
+    wasm_run_lap(&lapTime);
+    cachedModule = moduleCache.acquire(exepath, useMmap, useModuleCache, error_buf, sizeof(error_buf));
+    if (cachedModule)
+        shared.module = cachedModule->module;
+    metrics.loadMs = wasm_run_lap(&lapTime);
 
-    shared.module = wasm_runtime_load(buf, siz, error_buf, sizeof(error_buf));
     if (!shared.module) {
         std::string reason; reason = std::string(error_buf);
         std::string err; err = "Failed to load wasm module: " + reason;
@@ -311,7 +538,36 @@ aotFail:
         goto fail;
     }
 
-    if (!wasm_application_execute_main(shared.module_inst, 0, NULL)) {
+#if SUPPORTS_TIERING
+    // Small binaries are compiled by LLVM in no time, waiting for that beats the baseline tier
+    if (wamr_running_mode(shared.configuration) == Mode_Multi_Tier_JIT &&
+        wasm_runtime_get_module_package_type(shared.module) == Wasm_Module_Bytecode &&
+        cachedModule->buffer.size < shared.configuration.tierUpThreshold * 1024) {
+        wasm_runtime_set_running_mode(shared.module_inst, Mode_LLVM_JIT);
+    }
+#endif
+
+    metrics.instantiateMs = wasm_run_lap(&lapTime);
+
+    std::cout << "Time to first instruction: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count() / 1000.0
+              << "ms (" << (warm ? "warm" : "cold") << " runtime)" << std::endl;
+
+    monitor = std::make_unique<WasmRunMonitor>(shared.module_inst, wasm_runtime_get_exec_env_singleton(shared.module_inst));
+    monitor->start();
+    wasm_run_lap(&lapTime);
+
+    executed = wasm_application_execute_main(shared.module_inst, 0, NULL);
+
+    metrics.mainMs = wasm_run_lap(&lapTime);
+    monitor->stop();
+    metrics.peakMemory = monitor->peakMemory();
+    metrics.pagesGrown = monitor->pagesGrown();
+    metrics.threadCount = monitor->peakThreads();
+    monitor.reset();
+    hostInterface->reportMetrics(metrics);
+
+    if (!executed) {
         if (!shared.killing) {
             const auto reason = std::string(wasm_runtime_get_exception(shared.module_inst));
             const auto err = "Uncaught exception: " + reason;
@@ -324,6 +580,15 @@ aotFail:
 
     shared.killed = false;
     exitCode = wasm_runtime_get_wasi_exit_code(shared.module_inst);
+
+#if SUPPORTS_TIERING
+    if (wasm_runtime_get_running_mode(shared.module_inst) == Mode_Multi_Tier_JIT) {
+        uint32_t functions = 0;
+        const auto promoted = promoted_functions(shared.module, &functions);
+        hostInterface->report("Tiered up " + std::to_string(promoted) + " of " +
+                              std::to_string(functions) + " functions to LLVM JIT");
+    }
+#endif
     hostInterface->reportExit(exitCode);
     std::cout << "Execution complete, exit code:" << exitCode << std::endl;
 
@@ -331,22 +596,6 @@ fail:
     // Whether killed or not, we can reset state here
     shared.killing = false;
 
-    if (!useMmap) {
-        if (buf) {
-            BH_FREE(buf);
-            buf = nullptr;
-        }
-    } else {
-        if (buf) {
-            munmap(buf, siz);
-            buf = nullptr;
-        }
-        if (fd >= 0) {
-            close(fd);
-            fd = -1;
-        }
-    }
-
     if (shared.exec_env) {
         wasm_runtime_destroy_exec_env(shared.exec_env);
         shared.exec_env = nullptr;
@@ -355,9 +604,19 @@ fail:
         wasm_runtime_deinstantiate(shared.module_inst);
         shared.module_inst = nullptr;
     }
-    if (shared.module) {
-        wasm_runtime_unload(shared.module);
+    if (cachedModule) {
+        // Stays loaded for the next run
         shared.module = nullptr;
+        moduleCache.release(cachedModule);
+        cachedModule.reset();
+    }
+    if (threadEnv) {
+        wasm_runtime_destroy_thread_env();
+        threadEnv = false;
+    }
+    if (shared.initialized) {
+        release_wamr_runtime();
+        shared.initialized = false;
     }
 
     return exitCode;
@@ -365,8 +624,12 @@ fail:
 
 void WasmRunnerJITImpl::destroy()
 {
+    // The runtime itself stays around for the next run
     std::lock_guard<std::mutex> lock(shared.runtimeMutex);
-    wasm_runtime_destroy();
+    if (shared.initialized) {
+        release_wamr_runtime();
+        shared.initialized = false;
+    }
 }
 
 void WasmRunnerJITImpl::stop()
@@ -174,6 +174,7 @@ int main(int argc, char *argv[])
         qmlRegisterUncreatableType<InputMethodFixerInstaller>("Tide", 1, 0, "ImFixerInstaller", "Instantiated in main() as 'imFixer'.");
         qmlRegisterUncreatableType<SearchResult>("Tide", 1, 0, "SearchResult", "Created 'searchAndReplace'.");
         qmlRegisterUncreatableType<TidePlugin>("Tide", 1, 0, "TidePlugin", "TidePlugin is created by 'TidePluginManager'");
+        qmlRegisterUncreatableType<CompletionModel>("Tide", 1, 0, "CompletionModel", "CompletionModel is provided by 'AutoCompleter'");
         
         {
             SystemGlue iosSystemGlue;
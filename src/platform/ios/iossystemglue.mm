@@ -135,6 +135,15 @@ bool IosSystemGlue::runBuildCommands(const QStringList cmds, const StdioSpec spe
     return true;
 }
 
+// nosystem runs commands in-process with global stdio, so they can't overlap
+bool IosSystemGlue::runParallelBuildCommands(const QStringList cmds, const int jobs, const bool failFast,
+                                             const StdioSpec spec)
+{
+    Q_UNUSED(jobs);
+    Q_UNUSED(failFast);
+    return runBuildCommands(cmds, spec);
+}
+
 // Blocking and hence shouldn't be called from the main or GUI threads
 int IosSystemGlue::runCommand(const QString cmd, const StdioSpec spec)
 {
@@ -173,6 +182,12 @@ void IosSystemGlue::killBuildCommands()
     m_requestBuildStop = true;
 }
 
+// A stop requested while no commands ran must not carry over into the next build
+void IosSystemGlue::resetBuildCommands()
+{
+    m_requestBuildStop = false;
+}
+
 void IosSystemGlue::writeToStdIn(const QByteArray data)
 {
     fwrite(data.constData(), sizeof(const char*), data.length(), m_consumerSpec.std_in);
@@ -146,6 +146,14 @@ bool MacSystemGlue::runBuildCommands(const QStringList cmds, const StdioSpec spe
     return true;
 }
 
+bool MacSystemGlue::runParallelBuildCommands(const QStringList cmds, const int jobs, const bool failFast,
+                                             const StdioSpec spec)
+{
+    Q_UNUSED(jobs);
+    Q_UNUSED(failFast);
+    return runBuildCommands(cmds, spec);
+}
+
 // Blocking and hence shouldn't be called from the main or GUI threads
 int MacSystemGlue::runCommand(const QString cmd, const StdioSpec spec)
 {
@@ -215,6 +223,12 @@ void MacSystemGlue::killBuildCommands()
     m_requestBuildStop = true;
 }
 
+// A stop requested while no commands ran must not carry over into the next build
+void MacSystemGlue::resetBuildCommands()
+{
+    m_requestBuildStop = false;
+}
+
 void MacSystemGlue::writeToStdIn(const QByteArray data)
 {
     fwrite(data.constData(), sizeof(const char*), data.length(), m_consumerSpec.std_in);
@@ -7,15 +7,18 @@
 #include <QUrl>
 #include <QProcess>
 #include <QDesktopServices>
+#include <QThread>
 
+#include <algorithm>
 #include <thread>
+#include <vector>
 
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <spawn.h>
 #include <unistd.h>
 
-PosixSystemGlue::PosixSystemGlue(QObject* parent) : QObject(parent)
+PosixSystemGlue::PosixSystemGlue(QObject* parent) : QObject(parent), m_requestBuildStop{false}
 {
     const auto currPath = qgetenv("PATH");
     const auto prefix = QString::fromUtf8(qgetenv("SNAP")) + QString("/usr/bin:");
@@ -124,6 +127,9 @@ bool PosixSystemGlue::runBuildCommands(const QStringList cmds, const StdioSpec s
     bool ret = true;
 
     for (const auto& command : cmds) {
+        if (m_requestBuildStop)
+            break;
+
         Command cmd = runCommand(command, spec);
         if (waitCommand(cmd) != 0) {
             ret = false;
@@ -131,6 +137,114 @@ bool PosixSystemGlue::runBuildCommands(const QStringList cmds, const StdioSpec s
         }
     }
 
+    if (m_requestBuildStop) {
+        m_requestBuildStop = false;
+        return false;
+    }
+
+    return ret;
+}
+
+// Blocking and hence shouldn't be called from the main or GUI threads.
+// Runs independent commands with up to 'jobs' of them at once, 0 meaning one per core.
+// Each command's output is captured and written out in one piece once it exits.
+bool PosixSystemGlue::runParallelBuildCommands(const QStringList cmds, const int jobs, const bool failFast,
+                                               const StdioSpec spec)
+{
+    struct Job {
+        Command cmd;
+        FILE* output;
+        QString command;
+    };
+
+    const int maxJobs = (jobs > 0) ? jobs : std::max(1, QThread::idealThreadCount());
+    const StdioSpec target = (spec.std_in || spec.std_out || spec.std_err) ? spec : m_spec;
+
+    const auto flushOutput = [&](FILE* output) {
+        char buffer[4096];
+        size_t read = 0;
+
+        rewind(output);
+        while ((read = fread(buffer, sizeof(char), sizeof(buffer), output)) > 0) {
+            fwrite(buffer, sizeof(char), read, target.std_out);
+        }
+        fflush(target.std_out);
+        fclose(output);
+    };
+
+    std::vector<Job> running;
+    int next = 0;
+    bool ret = true;
+
+    while (next < cmds.size() || !running.empty()) {
+        const bool stopping = m_requestBuildStop || (!ret && failFast);
+
+        if (stopping) {
+            for (auto& job : running) {
+                killCommand(job.cmd);
+                fclose(job.output);
+            }
+            running.clear();
+            break;
+        }
+
+        while (ret || !failFast) {
+            if (next >= cmds.size() || running.size() >= (size_t)maxJobs)
+                break;
+
+            FILE* output = tmpfile();
+            if (!output) {
+                qWarning() << "Failed to create build output buffer";
+                ret = false;
+                break;
+            }
+
+            StdioSpec jobSpec;
+            jobSpec.std_in = target.std_in;
+            jobSpec.std_out = output;
+            jobSpec.std_err = output;
+
+            const QString command = cmds[next++];
+            Command cmd = runCommand(command, jobSpec);
+            if (cmd.pid < 1) {
+                fclose(output);
+                ret = false;
+                continue;
+            }
+
+            running.push_back({ cmd, output, command });
+        }
+
+        bool reaped = false;
+        for (auto it = running.begin(); it != running.end();) {
+            int status = 0;
+            if (waitpid(it->cmd.pid, &status, WNOHANG) != it->cmd.pid) {
+                ++it;
+                continue;
+            }
+
+            closeStdio(it->cmd);
+            flushOutput(it->output);
+
+            if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+                qWarning() << "Build command failed with status" << status << ":" << it->command;
+                ret = false;
+            }
+
+            it = running.erase(it);
+            reaped = true;
+        }
+
+        if (!reaped && !running.empty()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    }
+
+    if (m_requestBuildStop) {
+        m_requestBuildStop = false;
+        return false;
+    }
+
     return ret;
 }
 
@@ -200,22 +314,27 @@ Command PosixSystemGlue::runCommand(const QString cmd, const StdioSpec spec)
     return ret;
 }
 
-int PosixSystemGlue::waitCommand(Command& cmd)
+void PosixSystemGlue::closeStdio(Command& cmd)
 {
-    int status;
-
-    if (cmd.pid < 1)
-        return 0;
-
-    waitpid(cmd.pid, &status, 0);
-
     if (cmd.stdio.std_in)
         fclose(cmd.stdio.std_in);
     if (cmd.stdio.std_out)
         fclose(cmd.stdio.std_out);
     if (cmd.stdio.std_err)
         fclose(cmd.stdio.std_err);
+    cmd.stdio = StdioSpec();
     cmd.pid = 0;
+}
+
+int PosixSystemGlue::waitCommand(Command& cmd)
+{
+    int status;
+
+    if (cmd.pid < 1)
+        return 0;
+
+    waitpid(cmd.pid, &status, 0);
+    closeStdio(cmd);
 
     return WEXITSTATUS(status);
 }
@@ -229,18 +348,18 @@ void PosixSystemGlue::killCommand(Command& cmd)
 
     kill(cmd.pid, SIGKILL);
     waitpid(cmd.pid, &status, 0);
-
-    if (cmd.stdio.std_in)
-        fclose(cmd.stdio.std_in);
-    if (cmd.stdio.std_out)
-        fclose(cmd.stdio.std_out);
-    if (cmd.stdio.std_err)
-        fclose(cmd.stdio.std_err);
-    cmd.pid = 0;
+    closeStdio(cmd);
 }
 
 void PosixSystemGlue::killBuildCommands()
 {
+    m_requestBuildStop = true;
+}
+
+// A stop requested while no commands ran must not carry over into the next build
+void PosixSystemGlue::resetBuildCommands()
+{
+    m_requestBuildStop = false;
 }
 
 void PosixSystemGlue::writeToStdIn(const QByteArray data)
@@ -5,6 +5,8 @@
 #include <QUrl>
 #include <QRect>
 
+#include <atomic>
+
 #include "stdiospec.h"
 
 struct Command {
@@ -29,15 +31,21 @@ public:
     void killCommand(Command& cmd);
 
     Q_INVOKABLE bool runBuildCommands(const QStringList cmds, const StdioSpec spec = StdioSpec());
+    Q_INVOKABLE bool runParallelBuildCommands(const QStringList cmds, const int jobs, const bool failFast,
+                                              const StdioSpec spec = StdioSpec());
     Q_INVOKABLE void killBuildCommands();
+    Q_INVOKABLE void resetBuildCommands();
     Q_INVOKABLE void writeToStdIn(const QByteArray data);
     Q_INVOKABLE void setupStdIo();
     Q_INVOKABLE void copyToClipboard(const QString text);
     Q_INVOKABLE void share(const QString text, const QUrl url, const QRect pos);
 
 private:
+    static void closeStdio(Command& cmd);
+
     StdioSpec m_spec;
     StdioSpec m_consumerSpec;
+    std::atomic<bool> m_requestBuildStop;
 
 signals:
     void stdioWritersPrepared(StdioSpec spec);
@@ -133,6 +133,14 @@ bool PosixSystemGlue::runBuildCommands(const QStringList cmds, const StdioSpec s
     return ret;
 }
 
+bool PosixSystemGlue::runParallelBuildCommands(const QStringList cmds, const int jobs, const bool failFast,
+                                               const StdioSpec spec)
+{
+    Q_UNUSED(jobs);
+    Q_UNUSED(failFast);
+    return runBuildCommands(cmds, spec);
+}
+
 // Blocking and hence shouldn't be called from the main or GUI threads
 int PosixSystemGlue::runCommand(const QString cmd, const StdioSpec spec)
 {
@@ -203,6 +211,10 @@ void PosixSystemGlue::killBuildCommands()
 {
 }
 
+void PosixSystemGlue::resetBuildCommands()
+{
+}
+
 void PosixSystemGlue::writeToStdIn(const QByteArray data)
 {
     fwrite(data.constData(), sizeof(const char*), data.length(), m_consumerSpec.std_in);
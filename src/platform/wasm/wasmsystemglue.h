@@ -21,7 +21,10 @@ public:
 
     Q_INVOKABLE int runCommand(const QString cmd, const StdioSpec spec = StdioSpec());
     Q_INVOKABLE bool runBuildCommands(const QStringList cmds, const StdioSpec spec = StdioSpec());
+    Q_INVOKABLE bool runParallelBuildCommands(const QStringList cmds, const int jobs, const bool failFast,
+                                              const StdioSpec spec = StdioSpec());
     Q_INVOKABLE void killBuildCommands();
+    Q_INVOKABLE void resetBuildCommands();
     Q_INVOKABLE void writeToStdIn(const QByteArray data);
     Q_INVOKABLE void setupStdIo();
     Q_INVOKABLE void copyToClipboard(const QString text);
@@ -21,7 +21,7 @@ TidePlugin::~TidePlugin()
 
 const QString TidePlugin::name()
 {
-    if (!m_cache.name.isEmpty()) {
+    if (m_cache.valid || !m_cache.name.isEmpty()) {
         return m_cache.name;
     }
     const auto ret = m_loadable->name();
@@ -31,7 +31,7 @@ const QString TidePlugin::name()
 
 const QString TidePlugin::description()
 {
-    if (!m_cache.description.isEmpty()) {
+    if (m_cache.valid || !m_cache.description.isEmpty()) {
         return m_cache.description;
     }
     const auto ret = m_loadable->description();
@@ -41,7 +41,7 @@ const QString TidePlugin::description()
 
 const WasmLoadable::WasmLoaderFeature TidePlugin::features()
 {
-    if (m_cache.feature != 0) {
+    if (m_cache.valid || m_cache.feature != 0) {
         return m_cache.feature;
     }
     const auto ret = m_loadable->features();
@@ -54,6 +54,15 @@ WasmLoadableInterface TidePlugin::interface(const WasmLoadable::WasmLoaderFeatur
     return m_loadable->interface(feature);
 }
 
+void TidePlugin::setMetadata(const QString& name, const QString& description,
+                             const WasmLoadable::WasmLoaderFeature feature)
+{
+    m_cache.name = name;
+    m_cache.description = description;
+    m_cache.feature = feature;
+    m_cache.valid = true;
+}
+
 bool TidePlugin::isValid() const
 {
     return m_loadable->isValid();
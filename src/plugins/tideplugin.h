@@ -9,7 +9,8 @@
 struct TidePluginCache {
     QString name;
     QString description;
-    WasmLoadable::WasmLoaderFeature feature;
+    WasmLoadable::WasmLoaderFeature feature = WasmLoadable::NoneFeature;
+    bool valid = false; // Filled in without instantiating the plugin
 };
 
 class TidePlugin
@@ -31,6 +32,10 @@ public:
     const WasmLoadable::WasmLoaderFeature features();
     bool isValid() const;
 
+    // Metadata known from an earlier run, the plugin stays uninstantiated until used
+    void setMetadata(const QString& name, const QString& description,
+                     const WasmLoadable::WasmLoaderFeature feature);
+
     QSharedPointer<WasmLoadable> loadable();
 
 private:
@@ -1,13 +1,33 @@
 #include "tidepluginmanager.h"
 
+#include <QCryptographicHash>
+#include <QDebug>
 #include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
 #include <QStandardPaths>
+#include <QThreadPool>
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 #include <wasm_c_api.h>
 #include <wasm_export.h>
 
+#include "common/wasmmemorypool.h"
+
+// Linear memories and everything else not covered by the plugin budgets
+static constexpr size_t PoolBaseSize = 32 * 1024 * 1024;
+static constexpr size_t PoolMaxSize = 512 * 1024 * 1024;
+
+// Room for one plugin not seen before, whatever budget it declares
+static constexpr size_t PoolUncachedSize = 2 * (size_t)WasmLoadable::MaxStackSize + WasmLoadable::MaxHeapSize;
+
+// Kept mapped for the lifetime of the process, the runtime might outlive the manager
+static WasmMemoryPool pluginMemoryPool;
+
 TidePluginManager::TidePluginManager(QObject *parent)
     : QObject{parent}
 {
@@ -17,16 +37,30 @@ TidePluginManager::TidePluginManager(QObject *parent)
         plugin.mkpath(pluginDir);
     }
 
-    static char global_heap_buf[32 * 1024 * 1024];
+    // Plugins share one pool, sized from the budgets they declared in earlier runs.
+    // Each instance takes its stack twice, once for instantiation and once for its exec env.
+    // The pool can't grow while the runtime lives, so a newly installed plugin needs
+    // the headroom to load, and its budget counts from the next start on.
+    size_t poolSize = PoolBaseSize + PoolUncachedSize;
+    const QJsonObject cache = readMetadataCache();
+    for (const auto& entry : cache) {
+        const auto cached = entry.toObject();
+        poolSize += 2 * (size_t)cached.value("stackSize").toInteger() + (size_t)cached.value("heapSize").toInteger();
+    }
+    poolSize = std::min(poolSize, PoolMaxSize);
 
-    /* all the runtime memory allocations are retricted in the global_heap_buf array */
+    if (!pluginMemoryPool.reserve(poolSize, false)) {
+        return;
+    }
+
+    /* all the runtime memory allocations are retricted in the plugin memory pool */
     RuntimeInitArgs init_args;
     memset(&init_args, 0, sizeof(RuntimeInitArgs));
 
     /* configure the memory allocator for the runtime */
     init_args.mem_alloc_type = Alloc_With_Pool;
-    init_args.mem_alloc_option.pool.heap_buf = global_heap_buf;
-    init_args.mem_alloc_option.pool.heap_size = sizeof(global_heap_buf);
+    init_args.mem_alloc_option.pool.heap_buf = pluginMemoryPool.data();
+    init_args.mem_alloc_option.pool.heap_size = pluginMemoryPool.size();
 
 #if 0
     /* configure the native functions being exported to WASM app */
@@ -52,37 +86,158 @@ TidePluginManager::~TidePluginManager()
     wasm_runtime_destroy();
 }
 
+struct LoadedPlugin {
+    QString hash;
+    QSharedPointer<TidePlugin> plugin;
+    WasmLoadable::Budget budget;
+};
+
+static WasmLoadable::Budget cachedBudget(const QJsonObject& cached)
+{
+    WasmLoadable::Budget budget;
+    budget.stackSize = cached.value("stackSize").toInteger(budget.stackSize);
+    budget.heapSize = cached.value("heapSize").toInteger(budget.heapSize);
+    budget.timeoutMs = cached.value("timeoutMs").toInteger(budget.timeoutMs);
+    return budget;
+}
+
+// Runs on the loader pool. Plugins seen before get their metadata from the cache
+// and are only instantiated once a feature of theirs is used.
+static void loadPlugin(const QString& path, const QJsonObject& cache, LoadedPlugin& loaded)
+{
+    QFile file(path);
+    if (!file.open(QFile::ReadOnly))
+        return;
+
+    const QByteArray contents = file.readAll();
+    loaded.hash = QCryptographicHash::hash(contents, QCryptographicHash::Sha256).toHex();
+
+    auto plugin = QSharedPointer<TidePlugin>(new TidePlugin(path));
+    const auto cached = cache.value(loaded.hash).toObject();
+    if (!cached.isEmpty())
+        plugin->loadable()->setBudget(cachedBudget(cached));
+
+    // Plugins that failed before are tried again, with the budget they declared back then
+    if (!cached.isEmpty() && !cached.value("failed").toBool()) {
+        plugin->setMetadata(cached.value("name").toString(),
+                            cached.value("description").toString(),
+                            static_cast<WasmLoadable::WasmLoaderFeature>(cached.value("features").toInt()));
+    } else {
+        const bool instantiated = plugin->loadable()->instantiate(contents);
+
+        // Even a failed plugin might have declared its budget, which the pool
+        // might just not have had room for. The next start sizes the pool for it.
+        loaded.budget = plugin->loadable()->budget();
+        if (!instantiated)
+            return;
+
+        plugin->setMetadata(plugin->loadable()->name(),
+                            plugin->loadable()->description(),
+                            plugin->loadable()->features());
+    }
+
+    loaded.budget = plugin->loadable()->budget();
+    loaded.plugin = plugin;
+}
+
 void TidePluginManager::reloadPlugins()
 {
     const QString pluginDir = pluginsPath();
     QDirIterator dit(pluginDir, QDir::NoDotAndDotDot | QDir::AllEntries, QDirIterator::Subdirectories);
 
+    QStringList paths;
+    while(dit.hasNext()) {
+        const auto next = dit.next();
+        if (!next.endsWith(".a"))
+            continue;
+        paths << next;
+    }
+
     m_plugins.clear();
 
     {
+        const QJsonObject cache = readMetadataCache();
+        std::vector<LoadedPlugin> loaded(paths.size());
+
+        QThreadPool pool;
+        for (int i = 0; i < paths.size(); i++) {
+            pool.start([&paths, &cache, &loaded, i]() {
+                loadPlugin(paths[i], cache, loaded[i]);
+            });
+        }
+        pool.waitForDone();
+
+        // Only plugins still installed are kept in the cache
+        QJsonObject metadata;
         QList<QSharedPointer<TidePlugin>> plugins;
-        while(dit.hasNext()) {
-            const auto next = dit.next();
-            if (!next.endsWith(".a"))
+        for (const auto& next : loaded) {
+            const auto& plugin = next.plugin;
+            if (next.hash.isEmpty())
                 continue;
 
-            auto plugin = QSharedPointer<TidePlugin>(new TidePlugin(next));
-            if (!plugin->isValid())
+            if (!plugin) {
+                metadata.insert(next.hash, QJsonObject {
+                    { "failed", true },
+                    { "stackSize", (qint64)next.budget.stackSize },
+                    { "heapSize", (qint64)next.budget.heapSize },
+                    { "timeoutMs", (qint64)next.budget.timeoutMs }
+                });
                 continue;
+            }
 
             std::cout << "Plugin name: " << plugin->name().toStdString() << std::endl;
             std::cout << "Plugin description: " << plugin->description().toStdString() << std::endl;
             std::cout << "Plugin features: " << plugin->features() << std::endl;
 
+            const auto& budget = next.budget;
+            metadata.insert(next.hash, QJsonObject {
+                { "name", plugin->name() },
+                { "description", plugin->description() },
+                { "features", (int)plugin->features() },
+                { "stackSize", (qint64)budget.stackSize },
+                { "heapSize", (qint64)budget.heapSize },
+                { "timeoutMs", (qint64)budget.timeoutMs }
+            });
             plugins.push_back(plugin);
         }
 
+        if (metadata != cache)
+            writeMetadataCache(metadata);
+
         m_plugins = plugins;
     }
 
     emit pluginsChanged();
 }
 
+QJsonObject TidePluginManager::readMetadataCache()
+{
+    QFile file(metadataCachePath());
+    if (!file.open(QFile::ReadOnly))
+        return QJsonObject();
+
+    return QJsonDocument::fromJson(file.readAll()).object();
+}
+
+void TidePluginManager::writeMetadataCache(const QJsonObject& metadata)
+{
+    const QFileInfo info(metadataCachePath());
+    QDir().mkpath(info.absolutePath());
+
+    QFile file(info.absoluteFilePath());
+    if (!file.open(QFile::WriteOnly | QFile::Truncate)) {
+        qWarning() << "Failed to write plugin metadata cache" << file.fileName();
+        return;
+    }
+
+    file.write(QJsonDocument(metadata).toJson(QJsonDocument::Compact));
+}
+
+QString TidePluginManager::metadataCachePath()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/plugins.json";
+}
+
 QVariantList TidePluginManager::plugins()
 {
     QVariantList ret;
@@ -2,6 +2,7 @@
 #define TIDEPLUGINMANAGER_H
 
 #include <QObject>
+#include <QJsonObject>
 
 #include "plugins/tideplugin.h"
 
@@ -23,6 +24,9 @@ public slots:
 
 private:
     QVariantList plugins();
+    QJsonObject readMetadataCache();
+    void writeMetadataCache(const QJsonObject& metadata);
+    QString metadataCachePath();
 
     QList<QSharedPointer<TidePlugin>> m_plugins;
 
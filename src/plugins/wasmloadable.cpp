@@ -2,45 +2,159 @@
 
 #include <QDebug>
 #include <QFile>
+#include <QMutexLocker>
+#include <QtAlgorithms>
+#include <QtEndian>
 
+#include <algorithm>
 #include <iostream>
 
+#include "wasmwatchdog.h"
+
 typedef uint8_t uint8;
 
+static WasmWatchdog watchdog;
+
+struct WasmExportSignature {
+    const char* name;
+    uint32_t params;
+};
+
+// Indexed by WasmLoadable::WasmExport
+static const WasmExportSignature exportSignatures[WasmLoadable::WasmExportCount] = {
+    { "tide_plugin_features", 0 },
+    { "tide_plugin_name", 0 },
+    { "tide_plugin_description", 0 },
+    { "tide_plugin_get_interface", 1 },
+    { "tide_plugin_budget", 0 },
+    { "tide_plugin_autocompletor_setup", 2 },
+    { "tide_plugin_autocompletor_find", 2 },
+    { "tide_plugin_autocompletor_next", 1 },
+    { "tide_plugin_autocompletorresult_kind", 1 },
+    { "tide_plugin_autocompletorresult_type", 1 },
+    { "tide_plugin_autocompletorresult_identifier", 1 },
+    { "tide_plugin_autocompletorresult_detail", 1 },
+    { "tide_plugin_autocompletor_find_packed", 2 },
+};
+
 WasmLoadable::WasmLoadable(const QString& path) :
     m_path(path),
+    m_attempted{false},
+    m_budgetKnown{false},
+    m_expired{false},
+    m_instanceLock{QReadWriteLock::Recursive},
+    m_sharedMemory{false},
+    m_spawnedExecEnvs{0},
     module{nullptr},
     module_inst{nullptr},
-    exec_env{nullptr}
+    exec_env{nullptr},
+    m_exports{}
+{
+}
+
+bool WasmLoadable::instantiate(const QByteArray& contents)
 {
+    QMutexLocker<QMutex> locker(&m_instantiateMutex);
+
+    // The watchdog left the instance terminated, start over with a fresh one
+    if (m_expired && module) {
+        QWriteLocker instanceLocker(&m_instanceLock);
+        m_expired = false;
+        destroyInstance();
+        return createInstance();
+    }
+
+    // A plugin failing to load is not retried until the plugins get reloaded
+    if (m_attempted)
+        return module && module_inst && exec_env;
+    m_attempted = true;
+
     char error_buf[128];
-    uint32_t stack_size = 8092, heap_size = 8092;
 
-    /* read WASM file into a memory buffer */
-    QFile loadableFile(path);
-    if (!loadableFile.exists())
-        return;
+    if (!contents.isEmpty()) {
+        m_buffer = contents;
+    } else {
+        /* read WASM file into a memory buffer */
+        QFile loadableFile(m_path);
+        if (!loadableFile.exists())
+            return false;
 
-    if (!loadableFile.open(QFile::ReadOnly))
-        return;
+        if (!loadableFile.open(QFile::ReadOnly))
+            return false;
 
-    m_buffer = loadableFile.readAll();
+        m_buffer = loadableFile.readAll();
+    }
 
     /* parse the WASM file from buffer and create a WASM module */
     module = wasm_runtime_load((uint8*)m_buffer.data(), m_buffer.size(), error_buf, sizeof(error_buf));
+    if (!module) {
+        qWarning() << "Failed to load plugin" << m_path << ":" << error_buf;
+        return false;
+    }
+
+    {
+        QWriteLocker instanceLocker(&m_instanceLock);
+        if (!createInstance())
+            return false;
+    }
+
+    // The plugin can only be asked for its budget once it runs, so it gets
+    // instantiated again if it wants something else than the defaults
+    if (!m_budgetKnown) {
+        m_budgetKnown = true;
+        const Budget declared = declaredBudget();
+        if (!(declared == m_budget)) {
+            QWriteLocker instanceLocker(&m_instanceLock);
+            m_budget = declared;
+            destroyInstance();
+            return createInstance();
+        }
+    }
+
+    return true;
+}
+
+bool WasmLoadable::createInstance()
+{
+    char error_buf[128];
 
     /* create an instance of the WASM module (WASM linear memory is ready) */
-    module_inst = wasm_runtime_instantiate(module, stack_size, heap_size,
+    module_inst = wasm_runtime_instantiate(module, m_budget.stackSize, m_budget.heapSize,
                                            error_buf, sizeof(error_buf));
+    if (!module_inst) {
+        qWarning() << "Failed to instantiate plugin" << m_path << ":" << error_buf;
+        return false;
+    }
 
     /* creat an execution environment to execute the WASM functions */
-    exec_env = wasm_runtime_create_exec_env(module_inst, stack_size);
-    
+    exec_env = wasm_runtime_create_exec_env(module_inst, m_budget.stackSize);
+
+    // Spawned envs run in child instances, which only see the memory buffers
+    // are made in when it is shared. Everything else runs on exec_env.
+    const wasm_memory_inst_t memory = wasm_runtime_get_default_memory(module_inst);
+    m_sharedMemory = memory && wasm_memory_get_shared(memory);
+
+    resolveExports();
+
     std::cout << "Exec env ready: " << exec_env << std::endl;
+    return module_inst && exec_env;
 }
 
-WasmLoadable::~WasmLoadable()
+void WasmLoadable::destroyInstance()
 {
+    std::fill(std::begin(m_exports), std::end(m_exports), nullptr);
+
+    // Only called with the instance locked for writing, no env is checked out
+    {
+        QMutexLocker<QMutex> locker(&m_execEnvsMutex);
+        for (const auto spawned : std::as_const(m_idleExecEnvs)) {
+            wasm_runtime_destroy_spawned_exec_env(spawned->env);
+            delete spawned;
+        }
+        m_idleExecEnvs.clear();
+        m_spawnedExecEnvs = 0;
+    }
+
     if (exec_env) {
         wasm_runtime_destroy_exec_env(exec_env);
         exec_env = nullptr;
@@ -50,6 +164,11 @@ WasmLoadable::~WasmLoadable()
         wasm_runtime_deinstantiate(module_inst);
         module_inst = nullptr;
     }
+}
+
+WasmLoadable::~WasmLoadable()
+{
+    destroyInstance();
 
     if (module) {
         wasm_runtime_unload(module);
@@ -57,19 +176,198 @@ WasmLoadable::~WasmLoadable()
     }
 }
 
+void WasmLoadable::setBudget(const Budget& budget)
+{
+    QMutexLocker<QMutex> locker(&m_instantiateMutex);
+    m_budget = budget;
+    m_budgetKnown = true;
+}
+
+WasmLoadable::Budget WasmLoadable::budget()
+{
+    QMutexLocker<QMutex> locker(&m_instantiateMutex);
+    return m_budget;
+}
+
+// Reads the TidePluginBudget struct, zeroes keep the defaults
+WasmLoadable::Budget WasmLoadable::declaredBudget()
+{
+    Budget budget;
+
+    const auto ret = call_export(PluginBudget, {});
+    if (ret.of.i32 == 0 || !validate_buffer(ret.of.i32, 3 * sizeof(uint32_t)))
+        return budget;
+
+    const uchar* data = wasm_memory<const uchar*>(ret.of.i32);
+    const uint32_t stackSize = qFromLittleEndian<quint32>(data);
+    const uint32_t heapSize = qFromLittleEndian<quint32>(data + 4);
+    const uint32_t timeoutMs = qFromLittleEndian<quint32>(data + 8);
+
+    if (stackSize)
+        budget.stackSize = std::min(stackSize, MaxStackSize);
+    if (heapSize)
+        budget.heapSize = std::min(heapSize, MaxHeapSize);
+    if (timeoutMs)
+        budget.timeoutMs = std::min(timeoutMs, MaxTimeoutMs);
+
+    qDebug() << "Plugin" << m_path << "budget: stack" << budget.stackSize << "heap" << budget.heapSize
+             << "timeout" << budget.timeoutMs << "ms";
+    return budget;
+}
+
+wasm_val_t WasmLoadable::call_export(const WasmExport exported, std::initializer_list<int32_t> args)
+{
+    wasm_val_t ret;
+    memset(&ret, 0, sizeof(ret));
+
+    QReadLocker instanceLocker(&m_instanceLock);
+
+    // Nothing runs in a terminated instance until instantiate() replaced it
+    if (m_expired)
+        return ret;
+
+    wasm_function_inst_t func = m_exports[exported];
+    if (!func || args.size() > MaxExportParams)
+        return ret;
+
+    wasm_val_t argv[MaxExportParams];
+    uint32_t argc = 0;
+    for (const auto arg : args) {
+        argv[argc].kind = WASM_I32;
+        argv[argc++].of.i32 = arg;
+    }
+
+    SpawnedExecEnv* spawned = acquireExecEnv();
+    QMutexLocker<QMutex> sharedLocker(spawned ? nullptr : &m_sharedExecEnvMutex);
+    const wasm_exec_env_t env = spawned ? spawned->env : exec_env;
+    const wasm_module_inst_t env_inst = wasm_runtime_get_module_inst(env);
+    if (spawned) {
+        func = spawned->exports[exported];
+        if (!func) {
+            releaseExecEnv(spawned);
+            return ret;
+        }
+    }
+
+    const auto watch = watchdog.arm(module_inst, std::chrono::milliseconds(m_budget.timeoutMs));
+    const bool succeeded = wasm_runtime_call_wasm_a(env, func, 1, &ret, argc, argv);
+    if (watchdog.disarm(watch)) {
+        qWarning() << "Plugin" << m_path << "exceeded its budget of" << m_budget.timeoutMs << "ms, terminated";
+        m_expired = true;
+    }
+
+    if (!succeeded) {
+        printf("Exception: %s\n", wasm_runtime_get_exception(env_inst));
+        memset(&ret, 0, sizeof(ret));
+
+        // Exceptions stick to the instance and would fail every later call
+        wasm_runtime_clear_exception(env_inst);
+    }
+
+    if (spawned)
+        releaseExecEnv(spawned);
+
+    return ret;
+}
+
+// Envs are checked out per call from a small pool, so neither their number
+// nor their child instances grow with the threads that ever called in
+WasmLoadable::SpawnedExecEnv* WasmLoadable::acquireExecEnv()
+{
+    if (!m_sharedMemory)
+        return nullptr;
+
+    QMutexLocker<QMutex> locker(&m_execEnvsMutex);
+    if (!m_idleExecEnvs.isEmpty())
+        return m_idleExecEnvs.takeLast();
+
+    if (m_spawnedExecEnvs >= MaxSpawnedExecEnvs)
+        return nullptr;
+
+    // The child instance shares the memory and gets an aux stack of its own
+    const wasm_exec_env_t env = wasm_runtime_spawn_exec_env(exec_env);
+    if (!env) {
+        qWarning() << "Plugin" << m_path << "has no exec env to spare, sharing one";
+        return nullptr;
+    }
+
+    // Signatures were checked on the parent, the child instantiates the same module
+    auto spawned = new SpawnedExecEnv;
+    spawned->env = env;
+    const wasm_module_inst_t child_inst = wasm_runtime_get_module_inst(env);
+    for (int i = 0; i < WasmExportCount; i++) {
+        if (m_exports[i])
+            spawned->exports[i] = wasm_runtime_lookup_function(child_inst, exportSignatures[i].name);
+    }
+
+    m_spawnedExecEnvs++;
+    return spawned;
+}
+
+void WasmLoadable::releaseExecEnv(SpawnedExecEnv* spawned)
+{
+    QMutexLocker<QMutex> locker(&m_execEnvsMutex);
+    m_idleExecEnvs.append(spawned);
+}
+
+int WasmLoadable::featureIndex(const WasmLoaderFeature feature)
+{
+    return feature == NoneFeature ? 0 : qCountTrailingZeroBits((quint32)feature) % 8;
+}
+
+WasmLoadable::Session::Session(WasmLoadable& loadable, const WasmLoaderFeature feature) :
+    m_featureLocker(&loadable.m_featureMutexes[featureIndex(feature)]),
+    m_instanceLocker(&loadable.m_instanceLock)
+{
+}
+
+void WasmLoadable::resolveExports()
+{
+    if (!module_inst)
+        return;
+
+    for (int i = 0; i < WasmExportCount; i++) {
+        const auto& signature = exportSignatures[i];
+        wasm_function_inst_t func = wasm_runtime_lookup_function(module_inst, signature.name);
+        if (!func)
+            continue;
+
+        // Every export of the plugin API takes and returns i32 only
+        bool matches = wasm_func_get_param_count(func, module_inst) == signature.params &&
+                       wasm_func_get_result_count(func, module_inst) == 1;
+        if (matches) {
+            wasm_valkind_t types[MaxExportParams + 1];
+            wasm_func_get_param_types(func, module_inst, types);
+            for (uint32_t p = 0; p < signature.params; p++)
+                matches = matches && types[p] == WASM_I32;
+            wasm_func_get_result_types(func, module_inst, types);
+            matches = matches && types[0] == WASM_I32;
+        }
+
+        if (!matches) {
+            qWarning() << "Plugin" << m_path << "exports" << signature.name << "with an unexpected signature";
+            continue;
+        }
+
+        m_exports[i] = func;
+    }
+}
+
 bool WasmLoadable::isValid()
 {
     QFile wasmLoadable(m_path);
     if (!wasmLoadable.exists())
         return false;
 
-    return module && module_inst && exec_env;
+    return instantiate();
 }
 
 QString WasmLoadable::name()
 {
-    std::vector<wasm_val_t> args = {};
-    const auto ret = call_wasm_function("tide_plugin_name", args);
+    if (!instantiate())
+        return QString();
+
+    const auto ret = call_export(PluginName, {});
     if (ret.of.i32 == 0)
         return QString();
 
@@ -82,8 +380,10 @@ QString WasmLoadable::name()
 
 QString WasmLoadable::description()
 {
-    std::vector<wasm_val_t> args = {};
-    const auto ret = call_wasm_function("tide_plugin_description", args);
+    if (!instantiate())
+        return QString();
+
+    const auto ret = call_export(PluginDescription, {});
     if (ret.of.i32 == 0)
         return QString();
 
@@ -96,21 +396,18 @@ QString WasmLoadable::description()
 
 WasmLoadable::WasmLoaderFeature WasmLoadable::features()
 {
-    std::vector<wasm_val_t> args = {};
-    const auto ret = call_wasm_function("tide_plugin_features", args);
+    if (!instantiate())
+        return NoneFeature;
+
+    const auto ret = call_export(PluginFeatures, {});
     return static_cast<WasmLoadable::WasmLoaderFeature>(ret.of.i32);
 }
 
 WasmLoadableInterface WasmLoadable::interface(const WasmLoaderFeature feature)
 {
-    std::vector<wasm_val_t> args = {
-        {
-            .kind = WASM_I32,
-            .of {
-                .i32 = feature
-            }
-        }
-    };
-    const auto ret = call_wasm_function("tide_plugin_get_interface", args);
+    if (!instantiate())
+        return 0;
+
+    const auto ret = call_export(PluginGetInterface, { (int32_t)feature });
     return static_cast<WasmLoadableInterface>(ret.of.i32);
 }
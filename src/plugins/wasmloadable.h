@@ -2,10 +2,15 @@
 #define WASMLOADABLE_H
 
 #include <QObject>
+#include <QList>
+#include <QMutex>
+#include <QReadWriteLock>
 
 #include <wasm_c_api.h>
 #include <wasm_export.h>
 
+#include <atomic>
+#include <initializer_list>
 #include <vector>
 
 typedef int32_t WasmLoadableInterface;
@@ -22,11 +27,53 @@ public:
         IDEAutoComplete = (1 << 5),
     };
 
+    // Functions of the plugin API, resolved once when the plugin is loaded
+    enum WasmExport {
+        PluginFeatures = 0,
+        PluginName,
+        PluginDescription,
+        PluginGetInterface,
+        PluginBudget,
+        AutoCompletorSetup,
+        AutoCompletorFind,
+        AutoCompletorNext,
+        AutoCompletorResultKind,
+        AutoCompletorResultType,
+        AutoCompletorResultIdentifier,
+        AutoCompletorResultDetail,
+        AutoCompletorFindPacked,
+        WasmExportCount
+    };
+    static constexpr uint32_t MaxExportParams = 2;
+
+    // Resources a plugin may use, declared by tide_plugin_budget()
+    struct Budget {
+        uint32_t stackSize = 64 * 1024;
+        uint32_t heapSize = 64 * 1024;
+        uint32_t timeoutMs = 500;
+
+        bool operator==(const Budget& o) const {
+            return stackSize == o.stackSize && heapSize == o.heapSize && timeoutMs == o.timeoutMs;
+        }
+    };
+
+    // Upper limits of what a plugin may declare in its budget
+    static constexpr uint32_t MaxStackSize = 8 * 1024 * 1024;
+    static constexpr uint32_t MaxHeapSize = 64 * 1024 * 1024;
+    static constexpr uint32_t MaxTimeoutMs = 10 * 1000;
+
     WasmLoadable(const QString& path = QString());
     ~WasmLoadable();
     Q_DISABLE_COPY(WasmLoadable)
 
 public:
+    // Loads and instantiates the module on first use, contents saves reading the file again
+    bool instantiate(const QByteArray& contents = QByteArray());
+
+    // A budget known from an earlier run saves asking the plugin before instantiating it
+    void setBudget(const Budget& budget);
+    Budget budget();
+
     bool isValid();
     WasmLoaderFeature features();
 
@@ -34,61 +81,94 @@ public:
     QString description();
     WasmLoadableInterface interface(const WasmLoaderFeature feature);
 
+    // Held for a sequence of calls into one feature interface of the plugin.
+    // Calls into one feature are serialized, calls into different features may
+    // overlap, and the instance stays alive while it is held.
+    // Buffers made within a session must not be used past its end.
+    class Session
+    {
+    public:
+        Session(WasmLoadable& loadable, const WasmLoaderFeature feature);
+        Q_DISABLE_COPY(Session)
+
+    private:
+        QMutexLocker<QMutex> m_featureLocker;
+        QReadLocker m_instanceLocker;
+    };
+
     template<typename T>
     T wasm_memory(uint32_t addr) {
         return static_cast<T>(wasm_runtime_addr_app_to_native(module_inst, addr));
     }
 
-    wasm_val_t call_wasm_function(const QString& funcName, std::vector<wasm_val_t> &args) {
-        if (funcName.isEmpty()) {
-            wasm_val_t ret;
-            memset(&ret, 0, sizeof(ret));
-            return ret;
-        }
-
-        wasm_val_t results[1];
-        std::vector<wasm_val_t> argv;
-        argv.resize(args.size());
-
-        {
-            int i = 0;
-            for (const auto arg : args) {
-                memcpy(&argv[i++], &arg, sizeof(arg));
-            }
-        }
-
-        wasm_function_inst_t func = wasm_runtime_lookup_function(module_inst, funcName.toLocal8Bit().data());
-        if (!func) {
-            wasm_val_t ret;
-            memset(&ret, 0, sizeof(ret));
-            return ret;
-        }
+    bool has_export(const WasmExport exported) {
+        return m_exports[exported] != nullptr;
+    }
 
-        if (!wasm_runtime_call_wasm_a(exec_env, func, 1, results, argv.size(), argv.data())) {
-            printf("Exception: %s\n", wasm_runtime_get_exception(module_inst));
-            wasm_val_t ret;
-            memset(&ret, 0, sizeof(ret));
-            return ret;
-        }
+    // All exports take and return i32 only, which resolveExports() made sure of.
+    // Calls running past the plugin's time budget are terminated.
+    // Safe to call from any thread. Calls run in parallel only when the plugin's
+    // memory is shared, buffers made here are valid in every exec env then.
+    wasm_val_t call_export(const WasmExport exported, std::initializer_list<int32_t> args);
 
-        return results[0];
+    bool validate_buffer(uint32_t addr, uint32_t size) {
+        return wasm_runtime_validate_app_addr(module_inst, addr, size);
     }
 
+    // The plugin's malloc might not be thread-safe, so allocations are serialized
     uint32_t make_buffer(size_t size, void** buf) {
+        QMutexLocker<QMutex> locker(&m_allocMutex);
         return wasm_runtime_module_malloc(module_inst, size, buf);
     }
 
     void free_buffer(uint32_t ptr) {
+        QMutexLocker<QMutex> locker(&m_allocMutex);
         wasm_runtime_module_free(module_inst, ptr);
     }
 
 private:
+    bool createInstance();
+    void destroyInstance();
+    void resolveExports();
+    Budget declaredBudget();
+
+    // Calls on a spawned env run in its child instance, which has function instances of its own
+    struct SpawnedExecEnv {
+        wasm_exec_env_t env = nullptr;
+        wasm_function_inst_t exports[WasmExportCount] = {};
+    };
+    SpawnedExecEnv* acquireExecEnv();
+    void releaseExecEnv(SpawnedExecEnv* spawned);
+    static int featureIndex(const WasmLoaderFeature feature);
+
     QString m_path;
     QByteArray m_buffer;
+    QMutex m_instantiateMutex;
+    bool m_attempted;
+    bool m_budgetKnown;
+    Budget m_budget;
+    std::atomic<bool> m_expired;
+
+    // Guards the instance, calls hold it for reading and re-instantiation for writing
+    QReadWriteLock m_instanceLock;
+    QMutex m_featureMutexes[8];
+    QMutex m_allocMutex;
+
+    // Plugins with shared memory run calls in parallel on spawned exec envs,
+    // at most as many as the cluster has room for next to exec_env
+    static constexpr int MaxSpawnedExecEnvs = 4;
+    bool m_sharedMemory;
+    QMutex m_execEnvsMutex;
+    QList<SpawnedExecEnv*> m_idleExecEnvs;
+    int m_spawnedExecEnvs;
+
+    // Guards exec_env, which runs every call of plugins without shared memory
+    QMutex m_sharedExecEnvMutex;
 
     wasm_module_t module;
     wasm_module_inst_t module_inst;
     wasm_exec_env_t exec_env;
+    wasm_function_inst_t m_exports[WasmExportCount];
 };
 
 #endif // WASMLOADABLE_H
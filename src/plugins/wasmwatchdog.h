@@ -0,0 +1,103 @@
+#ifndef WASMWATCHDOG_H
+#define WASMWATCHDOG_H
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <wasm_export.h>
+
+// Terminates plugin calls that run past their deadline, one thread watches all of them.
+// wasm_runtime_terminate() only flags the instance, the interpreter bails out at
+// its next check and the instance stays terminated until it is instantiated anew.
+class WasmWatchdog
+{
+public:
+    ~WasmWatchdog()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_running = false;
+        }
+        m_wakeup.notify_all();
+        if (m_thread.joinable())
+            m_thread.join();
+    }
+
+    // Returns the handle to disarm the watch with once the call returned
+    uint64_t arm(wasm_module_inst_t moduleInst, const std::chrono::milliseconds timeout)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_thread.joinable()) {
+            m_running = true;
+            m_thread = std::thread([this]() { watch(); });
+        }
+
+        const uint64_t id = ++m_lastId;
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        m_watches[id] = { moduleInst, deadline };
+
+        // Only a new earliest deadline needs the thread to wake up early
+        if (deadline < m_nextDeadline)
+            m_wakeup.notify_one();
+        return id;
+    }
+
+    // Returns whether the call overran and got terminated
+    bool disarm(const uint64_t id)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_expired.erase(id) > 0)
+            return true;
+
+        m_watches.erase(id);
+        return false;
+    }
+
+private:
+    struct Watch {
+        wasm_module_inst_t moduleInst;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    void watch()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (m_running) {
+            const auto now = std::chrono::steady_clock::now();
+            m_nextDeadline = std::chrono::steady_clock::time_point::max();
+
+            for (auto it = m_watches.begin(); it != m_watches.end();) {
+                if (it->second.deadline <= now) {
+                    wasm_runtime_terminate(it->second.moduleInst);
+                    m_expired.insert(it->first);
+                    it = m_watches.erase(it);
+                    continue;
+                }
+                m_nextDeadline = std::min(m_nextDeadline, it->second.deadline);
+                ++it;
+            }
+
+            if (m_nextDeadline == std::chrono::steady_clock::time_point::max())
+                m_wakeup.wait(lock);
+            else
+                m_wakeup.wait_until(lock, m_nextDeadline);
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    std::thread m_thread;
+    bool m_running = false;
+    uint64_t m_lastId = 0;
+    std::map<uint64_t, Watch> m_watches;
+    std::set<uint64_t> m_expired;
+    std::chrono::steady_clock::time_point m_nextDeadline = std::chrono::steady_clock::time_point::max();
+};
+
+#endif // WASMWATCHDOG_H
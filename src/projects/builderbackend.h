@@ -3,6 +3,7 @@
 
 #include <QObject>
 #include <QString>
+#include <QVariantList>
 
 class BuilderBackend : public QObject {
     Q_OBJECT
@@ -31,8 +32,10 @@ signals:
     void buildingChanged();
     void buildSuccess(bool debug, bool aot);
     void buildError(QString str);
+    void buildStepsTimed(QVariantList steps);
     void cleaned();
     void runnableChanged();
+    void sourceFilesChanged();
 };
 
 #endif // BUILDERBACKEND_H
@@ -0,0 +1,174 @@
+#include "buildstatedb.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSqlError>
+#include <QSqlQuery>
+
+BuildStateDb::BuildStateDb(const QString& buildDirPath)
+{
+    const QString dbFilePath = buildDirPath + QStringLiteral("/.tide-buildstate.db");
+    m_connectionName = QStringLiteral("buildState-%1").arg(reinterpret_cast<quintptr>(this));
+
+    this->m_buildStateDb = QSqlDatabase::addDatabase("QSQLITE", m_connectionName);
+    this->m_buildStateDb.setDatabaseName(dbFilePath);
+
+    createDb();
+}
+
+BuildStateDb::~BuildStateDb()
+{
+    this->m_buildStateDb.close();
+    this->m_buildStateDb = QSqlDatabase();
+    QSqlDatabase::removeDatabase(m_connectionName);
+}
+
+void BuildStateDb::createDb()
+{
+    if (!this->m_buildStateDb.open()) {
+        qWarning() << "Failed to open build state database:"
+                   << this->m_buildStateDb.lastError().text();
+        return;
+    }
+
+    const QString create =
+        QStringLiteral("CREATE TABLE IF NOT EXISTS outputs (output TEXT, "
+                       "commandHash TEXT, dependencies TEXT, "
+                       "PRIMARY KEY(output));");
+
+    QSqlQuery createQuery(this->m_buildStateDb);
+    if (!createQuery.exec(create)) {
+        qWarning() << "Failed to create build state table:"
+                   << createQuery.lastError().text();
+    }
+}
+
+QHash<QString, BuildStateDb::Entry> BuildStateDb::entries()
+{
+    QHash<QString, Entry> ret;
+
+    if (!this->m_buildStateDb.isOpen())
+        return ret;
+
+    QSqlQuery query(this->m_buildStateDb);
+    if (!query.exec(QStringLiteral("SELECT output, commandHash, dependencies FROM outputs;"))) {
+        qWarning() << "Failed to query build state:" << query.lastError().text();
+        return ret;
+    }
+
+    while (query.next()) {
+        Entry entry;
+        entry.commandHash = query.value(1).toByteArray();
+        entry.dependencies = query.value(2).toString().split('\n', Qt::SkipEmptyParts);
+        ret.insert(query.value(0).toString(), entry);
+    }
+
+    return ret;
+}
+
+bool BuildStateDb::update(const QHash<QString, Entry>& entries)
+{
+    if (!this->m_buildStateDb.isOpen())
+        return false;
+
+    this->m_buildStateDb.transaction();
+
+    QSqlQuery query(this->m_buildStateDb);
+    query.prepare(QStringLiteral("INSERT OR REPLACE INTO outputs (output, commandHash, dependencies) "
+                                 "VALUES (:output, :commandHash, :dependencies);"));
+
+    for (auto it = entries.constBegin(); it != entries.constEnd(); ++it) {
+        query.bindValue(":output", it.key());
+        query.bindValue(":commandHash", it->commandHash);
+        query.bindValue(":dependencies", it->dependencies.join('\n'));
+        if (!query.exec()) {
+            qWarning() << "Failed to store build state:" << query.lastError().text();
+            this->m_buildStateDb.rollback();
+            return false;
+        }
+    }
+
+    return this->m_buildStateDb.commit();
+}
+
+QByteArray BuildStateDb::hashCommand(const QString& command)
+{
+    return QCryptographicHash::hash(command.toUtf8(), QCryptographicHash::Sha1).toHex();
+}
+
+// Make-style rules as written by 'clang -MD -MF', e.g.
+// foo.o: foo.cpp foo.h \
+//   dir\ with\ spaces/bar.h
+QStringList BuildStateDb::parseDepFile(const QString& path)
+{
+    QStringList ret;
+
+    QFile depFile(path);
+    if (!depFile.open(QFile::ReadOnly))
+        return ret;
+
+    const QString contents = QString::fromUtf8(depFile.readAll());
+
+    // Skip the rule's target
+    int pos = 0;
+    while (pos < contents.size()) {
+        if (contents[pos] == QChar(':') &&
+            (pos + 1 >= contents.size() || contents[pos + 1].isSpace()))
+            break;
+        pos++;
+    }
+
+    QString current;
+    for (pos++; pos < contents.size(); pos++) {
+        const QChar c = contents[pos];
+        if (c == QChar('\\') && pos + 1 < contents.size()) {
+            const QChar escaped = contents[pos + 1];
+            if (escaped == QChar('\n') || escaped == QChar('\r')) {
+                pos++;
+                continue;
+            }
+            if (escaped == QChar(' ') || escaped == QChar('#') || escaped == QChar('\\')) {
+                current += escaped;
+                pos++;
+                continue;
+            }
+        }
+
+        if (c.isSpace()) {
+            if (!current.isEmpty())
+                ret << current;
+            current.clear();
+            continue;
+        }
+
+        current += c;
+    }
+
+    if (!current.isEmpty())
+        ret << current;
+
+    return ret;
+}
+
+bool BuildStateDb::isStale(const QString& output, const QByteArray& commandHash, const Entry* entry)
+{
+    if (!entry || entry->commandHash != commandHash)
+        return true;
+
+    const QFileInfo outputInfo(output);
+    if (!outputInfo.exists())
+        return true;
+
+    const QDateTime outputTime = outputInfo.lastModified();
+    for (const auto& dependency : entry->dependencies) {
+        const QFileInfo dependencyInfo(dependency);
+        if (!dependencyInfo.exists() || dependencyInfo.lastModified() > outputTime)
+            return true;
+    }
+
+    return false;
+}
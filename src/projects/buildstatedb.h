@@ -0,0 +1,38 @@
+#ifndef BUILDSTATEDB_H
+#define BUILDSTATEDB_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QSqlDatabase>
+#include <QString>
+#include <QStringList>
+
+// Remembers how each build output was produced and what it depends on,
+// stored next to the outputs in the project's build directory.
+// Only to be used from the thread that created it.
+class BuildStateDb
+{
+public:
+    struct Entry {
+        QByteArray commandHash;
+        QStringList dependencies;
+    };
+
+    explicit BuildStateDb(const QString& buildDirPath);
+    ~BuildStateDb();
+
+    QHash<QString, Entry> entries();
+    bool update(const QHash<QString, Entry>& entries);
+
+    static QByteArray hashCommand(const QString& command);
+    static QStringList parseDepFile(const QString& path);
+    static bool isStale(const QString& output, const QByteArray& commandHash, const Entry* entry);
+
+private:
+    void createDb();
+
+    QString m_connectionName;
+    QSqlDatabase m_buildStateDb;
+};
+
+#endif // BUILDSTATEDB_H
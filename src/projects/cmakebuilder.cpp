@@ -4,12 +4,15 @@
 #include <QCryptographicHash>
 #include <QDir>
 #include <QFile>
+#include <QFileInfo>
 #include <QStandardPaths>
+#include <QThread>
 
+#include <algorithm>
 #include <thread>
 
 CMakeBuilder::CMakeBuilder(QObject *parent)
-    : BuilderBackend{parent}, iosSystem{nullptr}, m_building(false)
+    : BuilderBackend{parent}, iosSystem{nullptr}, m_building(false), m_buildJobs(0)
 {
 #ifndef Q_OS_LINUX
     const auto cmakePath = QStandardPaths::writableLocation(QStandardPaths::HomeLocation) +
@@ -26,6 +29,11 @@ void CMakeBuilder::setSysroot(const QString path)
     m_sysroot = path;
 }
 
+void CMakeBuilder::setBuildJobs(const int jobs)
+{
+    m_buildJobs = jobs;
+}
+
 bool CMakeBuilder::loadProject(const QString path)
 {
     if (!QFile::exists(path))
@@ -92,9 +100,9 @@ void CMakeBuilder::build(const bool debug, const bool aot, const bool exceptions
                                           " -DCMAKE_CXX_COMPILER_TARGET=wasm32-wasi-threads").arg(cmakePath, cmakeBinPath, m_sysroot);
     const auto cmakeArgs = cmakeRoot + QStringLiteral(" -DCMAKE_SYSTEM_NAME=WASI -DCMAKE_SYSTEM_VERSION=1 -DCMAKE_MAKE_PROGRAM=%1ninja ").arg(cmakeBinPath);
 
-    QStringList buildCommands;
-    buildCommands << QStringLiteral("%1cmake -G Ninja -S \"%2\" -B \"%3\" %4").arg(cmakeBinPath, sourcePath, buildPath, cmakeArgs);
-    buildCommands << QStringLiteral("%1ninja -C \"%2\" -j1").arg(cmakeBinPath, buildPath);
+    const int jobs = (m_buildJobs > 0) ? m_buildJobs : std::max(1, QThread::idealThreadCount());
+    const auto configureCommand = QStringLiteral("%1cmake -G Ninja -S \"%2\" -B \"%3\" %4").arg(cmakeBinPath, sourcePath, buildPath, cmakeArgs);
+    const auto ninjaCommand = QStringLiteral("%1ninja -C \"%2\" -j%3").arg(cmakeBinPath, buildPath, QString::number(jobs));
 
     std::thread buildThread([=]() {
         m_building = true;
@@ -102,7 +110,32 @@ void CMakeBuilder::build(const bool debug, const bool aot, const bool exceptions
 
         const auto pwd = QDir::currentPath();
         QDir::setCurrent(buildPath);
-        const bool success = iosSystem->runBuildCommands(buildCommands);
+
+        bool success = true;
+        const auto configureHash = QCryptographicHash::hash(configureCommand.toUtf8(), QCryptographicHash::Sha1).toHex();
+        if (needsConfigure(buildPath, configureHash)) {
+            success = iosSystem->runBuildCommands({ configureCommand });
+            if (success) {
+                QFile stamp(buildPath + QStringLiteral("/.tide-configure"));
+                if (stamp.open(QFile::WriteOnly | QFile::Truncate))
+                    stamp.write(configureHash);
+            }
+        } else {
+            qDebug() << "Configuration is up to date, skipping cmake";
+        }
+
+        if (success) {
+            // Only the entries appended by this run are of interest
+            const auto ninjaLogPath = buildPath + QStringLiteral("/.ninja_log");
+            const qint64 ninjaLogOffset = QFileInfo(ninjaLogPath).size();
+
+            success = iosSystem->runBuildCommands({ ninjaCommand });
+
+            const auto steps = ninjaSteps(ninjaLogPath, ninjaLogOffset);
+            if (!steps.isEmpty())
+                emit buildStepsTimed(steps);
+        }
+
         QDir::setCurrent(pwd);
         if (success) {
             emit buildSuccess(debug, aot);
@@ -116,6 +149,64 @@ void CMakeBuilder::build(const bool debug, const bool aot, const bool exceptions
     buildThread.detach();
 }
 
+bool CMakeBuilder::needsConfigure(const QString& buildPath, const QByteArray& configureHash)
+{
+    if (!QFile::exists(buildPath + QStringLiteral("/build.ninja")))
+        return true;
+
+    QFile stamp(buildPath + QStringLiteral("/.tide-configure"));
+    if (!stamp.open(QFile::ReadOnly) || stamp.readAll() != configureHash)
+        return true;
+
+    // Nested CMakeLists.txt changes are picked up by Ninja's own regeneration rule
+    return QFileInfo(m_projectFile).lastModified() > QFileInfo(stamp).lastModified();
+}
+
+// Parses the '# ninja log v5' lines (start, end, mtime, output, hash) from offset on,
+// slowest steps first. Start and end are milliseconds since Ninja was started.
+QVariantList CMakeBuilder::ninjaSteps(const QString& ninjaLogPath, const qint64 offset)
+{
+    QVariantList ret;
+
+    QFile ninjaLog(ninjaLogPath);
+    if (!ninjaLog.open(QFile::ReadOnly))
+        return ret;
+
+    // Ninja recompacted its log, entries of this run can't be told apart anymore
+    if (ninjaLog.size() < offset)
+        return ret;
+
+    ninjaLog.seek(offset);
+
+    QList<QPair<qint64, QString>> steps;
+    while (!ninjaLog.atEnd()) {
+        const auto line = QString::fromUtf8(ninjaLog.readLine()).trimmed();
+        if (line.isEmpty() || line.startsWith('#'))
+            continue;
+
+        const auto fields = line.split('\t');
+        if (fields.size() < 4)
+            continue;
+
+        const qint64 duration = fields[1].toLongLong() - fields[0].toLongLong();
+        steps.append(qMakePair(duration, fields[3]));
+    }
+
+    std::stable_sort(steps.begin(), steps.end(), [](const QPair<qint64, QString>& a, const QPair<qint64, QString>& b) {
+        return a.first > b.first;
+    });
+
+    for (const auto& step : steps) {
+        QVariantMap entry;
+        entry.insert("output", step.second);
+        entry.insert("duration", step.first);
+        ret << entry;
+        qDebug() << "Build step" << step.second << "took" << step.first << "ms";
+    }
+
+    return ret;
+}
+
 void CMakeBuilder::cancel()
 {
     iosSystem->killBuildCommands();
@@ -24,6 +24,8 @@ public:
     explicit CMakeBuilder(QObject *parent = nullptr);
     SystemGlue* iosSystem;
 
+    void setBuildJobs(const int jobs);
+
 public slots:
     void setSysroot(const QString path) override;
     bool loadProject(const QString path) override;
@@ -43,10 +45,13 @@ public slots:
 private:
     QString projectName();
     QString projectDir();
+    bool needsConfigure(const QString& buildPath, const QByteArray& configureHash);
+    QVariantList ninjaSteps(const QString& ninjaLogPath, const qint64 offset);
 
     QString m_sysroot;
     QString m_projectFile;
     bool m_building;
+    int m_buildJobs;
 
 signals:
     void commandRunnerChanged();
@@ -6,11 +6,42 @@
 #include <QStandardPaths>
 
 ProjectBuilder::ProjectBuilder(QObject *parent)
-    : QObject{parent}, m_iosSystem{nullptr}, m_building(false), m_activeBuilder{nullptr}
+    : QObject{parent}, m_iosSystem{nullptr}, m_building(false), m_buildJobs(0), m_failFast(true), m_activeBuilder{nullptr}
 {
     QObject::connect(this, &ProjectBuilder::refreshingProperties, this, &ProjectBuilder::runnableChanged);
 }
 
+int ProjectBuilder::buildJobs()
+{
+    return m_buildJobs;
+}
+
+void ProjectBuilder::setBuildJobs(const int jobs)
+{
+    if (m_buildJobs == jobs)
+        return;
+
+    m_buildJobs = jobs;
+    m_qmakeBuilder.setBuildJobs(jobs);
+    m_cmakeBuilder.setBuildJobs(jobs);
+    emit buildJobsChanged();
+}
+
+bool ProjectBuilder::failFast()
+{
+    return m_failFast;
+}
+
+void ProjectBuilder::setFailFast(const bool failFast)
+{
+    if (m_failFast == failFast)
+        return;
+
+    m_failFast = failFast;
+    m_qmakeBuilder.setFailFast(failFast);
+    emit failFastChanged();
+}
+
 void ProjectBuilder::setSysroot(const QString path)
 {
     m_sysroot = path;
@@ -65,10 +96,12 @@ bool ProjectBuilder::loadProject(const QString path)
 
     QObject::connect(m_activeBuilder, &BuilderBackend::buildError, this, &ProjectBuilder::buildError, Qt::DirectConnection);
     QObject::connect(m_activeBuilder, &BuilderBackend::buildSuccess, this, &ProjectBuilder::buildSuccess, Qt::DirectConnection);
+    QObject::connect(m_activeBuilder, &BuilderBackend::buildStepsTimed, this, &ProjectBuilder::buildStepsTimed, Qt::DirectConnection);
     QObject::connect(m_activeBuilder, &BuilderBackend::buildingChanged, this, &ProjectBuilder::buildingChanged, Qt::DirectConnection);
     QObject::connect(m_activeBuilder, &BuilderBackend::projectFileChanged, this, &ProjectBuilder::projectFileChanged, Qt::DirectConnection);
     QObject::connect(m_activeBuilder, &BuilderBackend::cleaned, this, &ProjectBuilder::cleaned, Qt::DirectConnection);
     QObject::connect(m_activeBuilder, &BuilderBackend::runnableChanged, this, &ProjectBuilder::runnableChanged, Qt::DirectConnection);
+    QObject::connect(m_activeBuilder, &BuilderBackend::sourceFilesChanged, this, &ProjectBuilder::sourceFilesChanged, Qt::DirectConnection);
 
     // Count already loaded project as a valid operation
     if (m_projectFile == path) {
@@ -105,6 +138,9 @@ void ProjectBuilder::build(const bool debug, const bool aot, const bool exceptio
         return;
     }
 
+    if (m_iosSystem)
+        m_iosSystem->resetBuildCommands();
+
     m_activeBuilder->build(debug, aot, exceptions);
 }
 
@@ -20,6 +20,8 @@ class ProjectBuilder : public QObject
     Q_PROPERTY(QString projectFile MEMBER m_projectFile NOTIFY projectFileChanged)
     Q_PROPERTY(QStringList sourceFiles READ sourceFiles NOTIFY sourceFilesChanged)
     Q_PROPERTY(bool building READ building NOTIFY buildingChanged)
+    Q_PROPERTY(int buildJobs READ buildJobs WRITE setBuildJobs NOTIFY buildJobsChanged)
+    Q_PROPERTY(bool failFast READ failFast WRITE setFailFast NOTIFY failFastChanged)
 
     // Refreshable properties
     Q_PROPERTY(bool runnable READ isRunnable NOTIFY runnableChanged)
@@ -27,6 +29,11 @@ class ProjectBuilder : public QObject
 public:
     explicit ProjectBuilder(QObject *parent = nullptr);
 
+    int buildJobs();
+    void setBuildJobs(const int jobs);
+    bool failFast();
+    void setFailFast(const bool failFast);
+
 public slots:
     void setSysroot(const QString path);
     bool loadProject(const QString path);
@@ -54,6 +61,8 @@ private:
     QString m_sysroot;
     QString m_projectFile;
     bool m_building;
+    int m_buildJobs;
+    bool m_failFast;
     CMakeBuilder m_cmakeBuilder;
     QMakeBuilder m_qmakeBuilder;
     ClickableBuilder m_clickableBuilder;
@@ -66,10 +75,13 @@ signals:
     void buildingChanged();
     void buildSuccess(bool debug, bool aot);
     void buildError(QString str);
+    void buildStepsTimed(QVariantList steps);
     void cleaned();
     void sourceFilesChanged();
     void runnableChanged();
     void refreshingProperties();
+    void buildJobsChanged();
+    void failFastChanged();
 };
 
 #endif // PROJECTBUILDER_H
@@ -1,10 +1,12 @@
 #include "qmakebuilder.h"
+#include "buildstatedb.h"
 
 #include <platform/systemglue.h>
 
 #include <QCryptographicHash>
 #include <QDir>
 #include <QFile>
+#include <QRegularExpression>
 #include <QStandardPaths>
 
 #include <thread>
@@ -29,9 +31,25 @@ inline static QString resolveDefaultVariables(const QString& line,
 }
 
 QMakeBuilder::QMakeBuilder(QObject *parent)
-    : BuilderBackend{parent}, iosSystem{nullptr}, m_building(false)
+    : BuilderBackend{parent}, iosSystem{nullptr}, m_building(false), m_buildJobs(0), m_failFast(true), m_variablesValid(false)
 {
     QObject::connect(this, &QMakeBuilder::projectFileChanged, this, &QMakeBuilder::runnableChanged);
+    QObject::connect(&m_projectWatcher, &QFileSystemWatcher::fileChanged, this, [=](const QString& path) {
+        qDebug() << "Project file changed:" << path;
+        invalidateProjectModel();
+        emit runnableChanged();
+        emit sourceFilesChanged();
+    });
+}
+
+void QMakeBuilder::setBuildJobs(const int jobs)
+{
+    m_buildJobs = jobs;
+}
+
+void QMakeBuilder::setFailFast(const bool failFast)
+{
+    m_failFast = failFast;
 }
 
 void QMakeBuilder::setSysroot(const QString path)
@@ -45,6 +63,7 @@ bool QMakeBuilder::loadProject(const QString path)
         return false;
 
     m_projectFile = path;
+    invalidateProjectModel();
     emit projectFileChanged();
 
     return true;
@@ -53,9 +72,74 @@ bool QMakeBuilder::loadProject(const QString path)
 void QMakeBuilder::unloadProject()
 {
     m_projectFile = "";
+    invalidateProjectModel();
     emit projectFileChanged();
 }
 
+void QMakeBuilder::invalidateProjectModel()
+{
+    m_variables = Variables();
+    m_variablesValid = false;
+
+    const auto watched = m_projectWatcher.files();
+    if (!watched.isEmpty())
+        m_projectWatcher.removePaths(watched);
+}
+
+const QMakeBuilder::Variables& QMakeBuilder::projectVariables()
+{
+    if (m_variablesValid)
+        return m_variables;
+
+    if (!m_projectFile.isEmpty()) {
+        QMakeParser projectParser;
+        projectParser.setProjectFile(m_projectFile);
+        m_variables = projectParser.getVariables();
+        watchProjectFiles();
+    }
+
+    m_variablesValid = true;
+    return m_variables;
+}
+
+// Watches the project file and everything it pulls in through include(),
+// editors replacing the file on save drop the watch so it is set up on every parse.
+void QMakeBuilder::watchProjectFiles()
+{
+    static const QRegularExpression includeExpression(QStringLiteral("\\binclude\\s*\\(\\s*([^)]+?)\\s*\\)"));
+
+    QStringList files;
+    QStringList pending { QFileInfo(m_projectFile).absoluteFilePath() };
+    while (!pending.isEmpty()) {
+        const auto path = pending.takeFirst();
+        if (files.contains(path))
+            continue;
+
+        QFile file(path);
+        if (!file.open(QFile::ReadOnly))
+            continue;
+        files << path;
+
+        const auto fileDirPath = QFileInfo(path).absolutePath();
+        const auto contents = QString::fromUtf8(file.readAll());
+        auto it = includeExpression.globalMatch(contents);
+        while (it.hasNext()) {
+            QString included = it.next().captured(1);
+            included.remove('"');
+            included = resolveDefaultVariables(included, fileDirPath, QString());
+            if (QFileInfo(included).isRelative())
+                included = fileDirPath + QDir::separator() + included;
+            pending << QFileInfo(included).absoluteFilePath();
+        }
+    }
+
+    const auto watched = m_projectWatcher.files();
+    if (!watched.isEmpty())
+        m_projectWatcher.removePaths(watched);
+    if (!files.isEmpty())
+        m_projectWatcher.addPaths(files);
+}
+
 void QMakeBuilder::clean()
 {
     const auto buildDirPath = projectBuildRoot();
@@ -97,11 +181,8 @@ void QMakeBuilder::build(const bool debug, const bool aot, const bool exceptions
         buildDir.mkpath(buildDirPath);
     }
 
-    QMakeParser projectParser;
-    projectParser.setProjectFile(m_projectFile);
-
     const auto sourceDirPath = QFileInfo(m_projectFile).absolutePath();
-    const auto variables = projectParser.getVariables();
+    const auto& variables = projectVariables();
 
     static const auto typeApp = QStringLiteral("app");
     auto projectTemplate = typeApp;
@@ -169,8 +250,9 @@ void QMakeBuilder::build(const bool debug, const bool aot, const bool exceptions
         }
     }
 
+    QStringList sourcesToCompile;
     QStringList objectsToLink;
-    QStringList buildCommands;
+    QStringList compileCommands;
 
     QString cFlags;
     if (variables.find("QMAKE_CFLAGS") != variables.end()) {
@@ -202,6 +284,7 @@ void QMakeBuilder::build(const bool debug, const bool aot, const bool exceptions
 
         const QString sourceFileName = QFileInfo(sourceFile).fileName();
         const QString buildObject = buildDirPath + QDir::separator() + sourceFileName + ".o";
+        sourcesToCompile << sourceFile;
         objectsToLink << buildObject;
 
         const auto compiler = source.endsWith(".c") ? QStringLiteral("clang") : QStringLiteral("clang++");
@@ -213,11 +296,12 @@ void QMakeBuilder::build(const bool debug, const bool aot, const bool exceptions
                                 commonFlags +
                                 includeFlags +
                                 defineFlags +
+                                QStringLiteral(" -MD -MF \"%1.d\" ").arg(buildObject) +
                                 QStringLiteral(" -o \"%1\" ").arg(buildObject) +
                                 QStringLiteral(" \"%1\"").arg(sourceFile) +
                                 (source.endsWith(".c") ? cFlags : cxxFlags);
         qDebug() << "Compile command:" << command;
-        buildCommands << command;
+        compileCommands << command;
     }
 
     QString objectFlags;
@@ -254,13 +338,73 @@ void QMakeBuilder::build(const bool debug, const bool aot, const bool exceptions
                                 QStringLiteral(" -o \"%1\"").arg(runnableFile());
 
     qDebug() << "Link command:" << linkCommand;
-    buildCommands << linkCommand;
+
+    const QString runnable = runnableFile();
+
+    const int jobs = m_buildJobs;
+    const bool failFast = m_failFast;
 
     std::thread buildThread([=]() {
         m_building = true;
         emit buildingChanged();
 
-        const bool success = iosSystem->runBuildCommands(buildCommands);
+        BuildStateDb buildState(buildDirPath);
+        const auto entries = buildState.entries();
+        const auto entryFor = [&](const QString& output) -> const BuildStateDb::Entry* {
+            const auto it = entries.constFind(output);
+            return (it != entries.constEnd()) ? &it.value() : nullptr;
+        };
+
+        QList<int> staleIndices;
+        QStringList staleCommands;
+        for (int i = 0; i < objectsToLink.size(); i++) {
+            const auto& object = objectsToLink[i];
+            if (!BuildStateDb::isStale(object, BuildStateDb::hashCommand(compileCommands[i]), entryFor(object)))
+                continue;
+
+            // Leftovers of an earlier build must not pass as freshly compiled
+            QFile::remove(object);
+            staleIndices << i;
+            staleCommands << compileCommands[i];
+        }
+
+        qDebug() << staleCommands.size() << "of" << compileCommands.size() << "objects need to be built";
+
+        // Objects don't depend on each other, linking waits for all of them
+        bool success = iosSystem->runParallelBuildCommands(staleCommands, jobs, failFast);
+
+        // Record whatever got built, even if other objects failed
+        QHash<QString, BuildStateDb::Entry> updated;
+        for (const auto i : staleIndices) {
+            const auto& object = objectsToLink[i];
+            if (!QFile::exists(object))
+                continue;
+
+            BuildStateDb::Entry entry;
+            entry.commandHash = BuildStateDb::hashCommand(compileCommands[i]);
+            entry.dependencies = BuildStateDb::parseDepFile(object + QStringLiteral(".d"));
+            if (entry.dependencies.isEmpty())
+                entry.dependencies << sourcesToCompile[i];
+            updated.insert(object, entry);
+        }
+
+        if (success) {
+            BuildStateDb::Entry linkEntry;
+            linkEntry.commandHash = BuildStateDb::hashCommand(linkCommand);
+            linkEntry.dependencies = objectsToLink;
+
+            if (!staleIndices.isEmpty() ||
+                BuildStateDb::isStale(runnable, linkEntry.commandHash, entryFor(runnable))) {
+                success = iosSystem->runBuildCommands({ linkCommand });
+                if (success)
+                    updated.insert(runnable, linkEntry);
+            } else {
+                qDebug() << "Link step is up to date";
+            }
+        }
+
+        buildState.update(updated);
+
         if (success) {
             emit buildSuccess(debug, aot);
         } else {
@@ -287,10 +431,7 @@ QString QMakeBuilder::runnableFile()
         return QString();
     }
 
-    QMakeParser projectParser;
-    projectParser.setProjectFile(m_projectFile);
-
-    const auto variables = projectParser.getVariables();
+    const auto& variables = projectVariables();
     if (variables.find("TARGET") == variables.end()) {
         const auto err = "No TARGET found in project file.";
         qWarning() << err;
@@ -315,12 +456,9 @@ QString QMakeBuilder::runnableFile()
 QStringList QMakeBuilder::includePaths()
 {
     QStringList ret;
-    QMakeParser projectParser;
-    projectParser.setProjectFile(m_projectFile);
-
     const auto buildDirPath = projectBuildRoot();
     const auto sourceDirPath = QFileInfo(m_projectFile).absolutePath();
-    const auto variables = projectParser.getVariables();
+    const auto& variables = projectVariables();
 
     if (variables.find("INCLUDEPATH") != variables.end()) {
         const auto includes = variables.at("INCLUDEPATH");
@@ -350,10 +488,7 @@ QString QMakeBuilder::sourceRoot()
 QString QMakeBuilder::projectBuildRoot()
 {
     QString ret = buildRoot() + QDir::separator();
-    QMakeParser projectParser;
-    projectParser.setProjectFile(m_projectFile);
-
-    const auto variables = projectParser.getVariables();
+    const auto& variables = projectVariables();
     if (variables.find("TARGET") == variables.end()) {
         const auto err = "No TARGET found in project file.";
         qWarning() << err;
@@ -386,11 +521,8 @@ QStringList QMakeBuilder::sourceFiles()
         buildDir.mkpath(buildDirPath);
     }
 
-    QMakeParser projectParser;
-    projectParser.setProjectFile(m_projectFile);
-
     const auto sourceDirPath = QFileInfo(m_projectFile).absolutePath();
-    const auto variables = projectParser.getVariables();
+    const auto& variables = projectVariables();
 
     if (variables.find("SOURCES") == variables.end()) {
         const auto err = "No SOURCES found in project file.";
@@ -415,11 +547,8 @@ bool QMakeBuilder::isRunnable()
 {
     // Defaults to true or rather TEMPLATE=app if not provided otherwise
 
-    QMakeParser projectParser;
-    projectParser.setProjectFile(m_projectFile);
-
     const auto sourceDirPath = QFileInfo(m_projectFile).absolutePath();
-    const auto variables = projectParser.getVariables();
+    const auto& variables = projectVariables();
 
     if (variables.find("TEMPLATE") == variables.end()) {
         const auto err = "No TEMPLATE found in project file, assuming 'app'.";
@@ -1,11 +1,15 @@
 #ifndef QMAKEBUILDER_H
 #define QMAKEBUILDER_H
 
+#include <QFileSystemWatcher>
 #include <QObject>
 #include <QString>
 
 #include <qmakeparser.h>
 
+#include <type_traits>
+#include <utility>
+
 #include "builderbackend.h"
 #include "platform/systemglue.h"
 
@@ -22,6 +26,9 @@ public:
     explicit QMakeBuilder(QObject *parent = nullptr);
     SystemGlue* iosSystem;
 
+    void setBuildJobs(const int jobs);
+    void setFailFast(const bool failFast);
+
 public slots:
     void setSysroot(const QString path) override;
     bool loadProject(const QString path) override;
@@ -39,9 +46,23 @@ public slots:
     bool isRunnable() override;
 
 private:
+    using Variables = std::decay_t<decltype(std::declval<QMakeParser&>().getVariables())>;
+
+    const Variables& projectVariables();
+    void invalidateProjectModel();
+    void watchProjectFiles();
+
     QString m_sysroot;
     QString m_projectFile;
     bool m_building;
+    int m_buildJobs;
+    bool m_failFast;
+
+    // Parsed on first use, dropped whenever the project file or its includes change.
+    // Only to be used from the GUI thread.
+    Variables m_variables;
+    bool m_variablesValid;
+    QFileSystemWatcher m_projectWatcher;
 
 signals:
     void commandRunnerChanged();
@@ -18,6 +18,7 @@ Item {
     AutoCompleter {
         id: autoCompleter
         pluginsManager: pluginManager
+        decls.filter: input !== null ? input.text : ""
 
         onDeclsChanged: {
             console.log("'Add Breakpoint' decls changed");
@@ -129,7 +130,7 @@ Item {
                 verticalAlignment: Qt.AlignVCenter
                 width: autoCompletorFrame.width
                 height: parent.height
-                visible: autoCompletionList.model.length === 0
+                visible: autoCompletionList.count === 0
             }
 
             ScrollView {
@@ -141,11 +142,7 @@ Item {
 
                 ListView {
                     id: autoCompletionList
-                    model: autoCompletorFrame.state !== "compact" && input.text !== "" ?
-                               autoCompleter.filteredDecls(input.text) :
-                               autoCompletorFrame.state === "compact" && input.text !== "" ?
-                                   autoCompleter.filteredDecls(input.text) :
-                                   autoCompleter.decls
+                    model: autoCompleter.decls
                     contentWidth: contentItem.childrenRect.width
                     contentHeight: contentItem.childrenRect.height
                     width: parent.width
@@ -167,10 +164,10 @@ Item {
 
                     delegate: TidePrefixedButton {
                         width: autoCompletorFrame.width
-                        icon.source: autoCompletionList.iconForKind(modelData.kind)
-                        prefix: modelData.prefix
-                        text: modelData.name
-                        detail: modelData.detail !== "" ? qsTr("inside %1").arg(modelData.detail) :
+                        icon.source: autoCompletionList.iconForKind(model.kind)
+                        prefix: model.prefix
+                        text: model.name
+                        detail: model.detail !== "" ? qsTr("inside %1").arg(model.detail) :
                                                           qsTr("in %1").arg(autoCompletorRoot.projectName)
                         font.styleName: "Monospace"
                         font.bold: true
@@ -182,7 +179,7 @@ Item {
                         }
 
                         function insertCompletion() {
-                            input.text = modelData.name
+                            input.text = model.name
                         }
                     }
                 }
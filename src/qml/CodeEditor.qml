@@ -200,8 +200,8 @@ Item {
         const lang = languageForLowerCaseFileName(file.name.toLowerCase())
         console.log("Language: " + lang)
 
+        highlighter.setVisibleArea(scrollView.contentItem.contentY, scrollView.height)
         highlighter.setCurrentLanguage(lang)
-        //highlighter.setVisibleRect(codeView.width, codeView.height);
         reloadAst()
         lineNumbersHelper.refresh()
     }
@@ -274,7 +274,8 @@ Item {
                 file.name.toLowerCase().endsWith(".h") || file.name.toLowerCase().endsWith(".hpp") ||
                 file.name.toLowerCase().endsWith(".cc") || file.name.toLowerCase().endsWith(".cxx")) {
             autoCompleter.setIncludePaths(projectBuilder.includePaths());
-            autoCompleter.reloadAst([file.path], "", AutoCompleter.Unspecified, /*codeField.currentLine*/ 0, /*codeField.currentColumn*/ 0)
+            autoCompleter.setUnsavedFile(file.path, codeField.text)
+            autoCompleter.reloadAst([file.path], "", AutoCompleter.Unspecified, codeField.currentLine, codeField.currentColumn)
         }
     }
 
@@ -301,6 +302,10 @@ Item {
 
     property var autoCompleter : AutoCompleter {
         pluginsManager: pluginManager
+        decls.filter: autoCompletorFrame.state !== "compact" && autoCompletionInput.text !== "" ?
+                          autoCompletionInput.text :
+                          autoCompletorFrame.state === "compact" && codeField.currentBlock !== "" ?
+                              codeField.currentBlock : ""
         onDeclsChanged: {
             console.log("Autocompleter decls changed");
         }
@@ -310,6 +315,13 @@ Item {
         id: cppFormatter
     }
 
+    Connections {
+        target: scrollView.contentItem
+        function onContentYChanged() {
+            highlighter.setVisibleArea(scrollView.contentItem.contentY, scrollView.height)
+        }
+    }
+
     Connections {
         target: root.palette
         function onChanged() {
@@ -713,7 +725,7 @@ Item {
                         Keys.onDownPressed:
                             (event) => {
                                 if (showAutoCompletor) {
-                                    autoCompletionList.currentIndex = Math.min(autoCompletionList.currentIndex + 1, autoCompletionList.model.length - 1)
+                                    autoCompletionList.currentIndex = Math.min(autoCompletionList.currentIndex + 1, autoCompletionList.count - 1)
                                     event.accepted = true
                                     return
                                 }
@@ -726,8 +738,8 @@ Item {
 
                                 if (showAutoCompletor) {
                                     const insertable = autoCompletionList.insertable(
-                                        autoCompletionList.model[autoCompletionList.currentIndex].name,
-                                        autoCompletionList.model[autoCompletionList.currentIndex].kind)
+                                        autoCompletionList.model.get(autoCompletionList.currentIndex).name,
+                                        autoCompletionList.model.get(autoCompletionList.currentIndex).kind)
                                     codeField.remove(codeField.startCursorPosition, codeField.cursorPosition)
                                     codeField.insert(codeField.startCursorPosition, insertable)
                                     codeEditor.showAutoCompletor = false
@@ -964,8 +976,8 @@ Item {
 
                                         onAccepted: {
                                             const insertable = autoCompletionList.insertable(
-                                                                 autoCompletionList.model[autoCompletionList.currentIndex].name,
-                                                                 autoCompletionList.model[autoCompletionList.currentIndex].kind)
+                                                                 autoCompletionList.model.get(autoCompletionList.currentIndex).name,
+                                                                 autoCompletionList.model.get(autoCompletionList.currentIndex).kind)
                                             codeField.insert(codeField.startCursorPosition, insertable)
                                             codeField.cursorPosition = codeField.startCursorPosition + insertable.length
                                             text = ""
@@ -974,11 +986,11 @@ Item {
 
                                         Keys.onUpPressed: {
                                             autoCompletionList.currentIndex =
-                                                    Math.abs(autoCompletionList.currentIndex - 1) % autoCompletionList.model.length
+                                                    Math.abs(autoCompletionList.currentIndex - 1) % autoCompletionList.count
                                         }
                                         Keys.onDownPressed: {
                                             autoCompletionList.currentIndex =
-                                                    Math.abs(autoCompletionList.currentIndex + 1) % autoCompletionList.model.length
+                                                    Math.abs(autoCompletionList.currentIndex + 1) % autoCompletionList.count
                                         }
                                     }
                                 }
@@ -991,7 +1003,7 @@ Item {
                                     verticalAlignment: Qt.AlignVCenter
                                     width: autoCompletorFrame.width
                                     height: 200
-                                    visible: autoCompletionList.model.length === 0
+                                    visible: autoCompletionList.count === 0
                                 }
 
                                 ScrollView {
@@ -1003,11 +1015,7 @@ Item {
 
                                     ListView {
                                         id: autoCompletionList
-                                        model: autoCompletorFrame.state !== "compact" && autoCompletionInput.text !== "" ?
-                                                   autoCompleter.filteredDecls(autoCompletionInput.text) :
-                                                   autoCompletorFrame.state === "compact" && codeField.currentBlock !== "" ?
-                                                       autoCompleter.filteredDecls(codeField.currentBlock) :
-                                                       autoCompleter.decls
+                                        model: autoCompleter.decls
                                         contentWidth: contentItem.childrenRect.width
                                         contentHeight: contentItem.childrenRect.height
                                         width: Math.min(contentWidth, autoCompletorFrame.maxWidth)
@@ -1035,10 +1043,10 @@ Item {
 
                                         delegate: TidePrefixedButton {
                                             width: autoCompletorFrame.width
-                                            icon.source: autoCompletionList.iconForKind(modelData.kind)
-                                            prefix: modelData.name
-                                            text: modelData.prefix
-                                            detail: modelData.detail !== "" ? qsTr("inside %1").arg(modelData.detail) :
+                                            icon.source: autoCompletionList.iconForKind(model.kind)
+                                            prefix: model.name
+                                            text: model.prefix
+                                            detail: model.detail !== "" ? qsTr("inside %1").arg(model.detail) :
                                                                               qsTr("in %1").arg(file.name)
                                             font.styleName: "Monospace"
                                             font.bold: true
@@ -1051,7 +1059,7 @@ Item {
                                             function insertCompletion() {
                                                 showAutoCompletor = false
                                                 codeField.insert(codeField.cursorPosition,
-                                                                 autoCompletionList.insertable(modelData.name, modelData.kind))
+                                                                 autoCompletionList.insertable(model.name, model.kind))
                                             }
                                         }
                                     }
@@ -52,6 +52,18 @@ Item {
         visibility = false
     }
 
+    function showRunMetrics(metrics) {
+        const peakMemory = (metrics.peakMemory / (1024 * 1024)).toFixed(1)
+        const content = qsTr("Load: %1 ms, instantiate: %2 ms, main: %3 ms").arg(metrics.loadMs.toFixed(1))
+                                                                                .arg(metrics.instantiateMs.toFixed(1))
+                                                                                .arg(metrics.mainMs.toFixed(1)) + "\n" +
+                        qsTr("Peak memory: %1 MB, pages grown: %2, threads: %3").arg(peakMemory)
+                                                                                  .arg(metrics.pagesGrown)
+                                                                                  .arg(metrics.threadCount)
+        consoleOutput.append({"content": content, "stdout": true})
+        consoleScrollView.positionViewAtEnd()
+    }
+
     ListModel {
         id: consoleOutput
     }
@@ -86,6 +86,7 @@ ColumnLayout {
               qsTr("• 'Clean' to remove build artifacts") + "\n" +
               qsTr("• 'Build' to compile the active project") + "\n" +
               qsTr("• 'Run' to run the active project") + "\n" +
+              qsTr("• 'Profile' to run the active project and print where its time went") + "\n" +
               qsTr("• 'Show/Hide Console' to spawn/hide the console view") + "\n" +
               "\n" +
               qsTr("CLI apps run in the console view and can be manipulated via stdin/out/err.") + "\n" +
@@ -140,6 +140,7 @@ ApplicationWindow {
     property bool releaseRequested : false
     property bool runRequested : false
     property bool debugRequested : false
+    property bool profileRequested : false
     property bool stopRequested : false
 
     signal fileSaved()
@@ -205,8 +206,6 @@ ApplicationWindow {
         if (settings.clearConsole)
             clearConsoleOutput()
 
-        projectBuilder.clean()
-
         // No AOT for releases
         const aot = !releaseRequested && settings.optimizations
         projectBuilder.build(debugRequested, aot, root.useExceptions)
@@ -235,7 +234,10 @@ ApplicationWindow {
                              settings.heapSize,
                              settings.threads,
                              platformProperties.supportsOptimizations && settings.optimizations);
-        wasmRunner.run(projectBuilder.runnableFile(), [], root.useExceptions)
+        if (profileRequested)
+            wasmRunner.profile(projectBuilder.runnableFile(), [], root.useExceptions)
+        else
+            wasmRunner.run(projectBuilder.runnableFile(), [], root.useExceptions)
     }
 
     function attemptDebug() {
@@ -291,6 +293,7 @@ ApplicationWindow {
         stopRequested = true
         debugRequested = false
         runRequested = false
+        profileRequested = false
         releaseRequested = false
 
         if (dbugger.running)
@@ -920,7 +923,7 @@ ApplicationWindow {
                                         Keys.onDownPressed:
                                             (event) => {
                                                 breakpointAutocompletor.list.currentIndex =
-                                                Math.min(breakpointAutocompletor.list.currentIndex + 1, breakpointAutocompletor.list.model.length - 1)
+                                                Math.min(breakpointAutocompletor.list.currentIndex + 1, breakpointAutocompletor.list.count - 1)
                                                 event.accepted = true
                                             }
                                     }
@@ -938,8 +941,8 @@ ApplicationWindow {
                                 onAccepted: {
                                     let type = "break"
                                     let canonicalName = breakpointSymbol.text
-                                    if (breakpointAutocompletor.list.model.length > 0) {
-                                        let suggestion = breakpointAutocompletor.list.model[breakpointAutocompletor.list.currentIndex]
+                                    if (breakpointAutocompletor.list.count > 0) {
+                                        let suggestion = breakpointAutocompletor.list.model.get(breakpointAutocompletor.list.currentIndex)
                                         if (suggestion.kind !== AutoCompleter.Function) {
                                             type = "watch"
                                         }
@@ -1049,6 +1052,7 @@ ApplicationWindow {
                                     root.attemptScriptRun()
                                 } else {
                                     root.debugRequested = false
+                                    root.profileRequested = false
                                     root.runRequested = true
                                     root.attemptBuild()
                                 }
@@ -1068,6 +1072,18 @@ ApplicationWindow {
                             root.attemptBuild()
                         }
                     }
+                    MenuItem {
+                        readonly property bool visibility: projectBuilder.projectFile !== "" && projectBuilder.runnable
+                        enabled: !projectBuilder.building && !wasmRunner.running && !dbugger.running && visibility
+                        text: qsTr("Profile")
+                        icon.source: Qt.resolvedUrl("qrc:/assets/figure.run@2x.png")
+                        onClicked: {
+                            root.debugRequested = false
+                            root.profileRequested = true
+                            root.runRequested = true
+                            root.attemptBuild()
+                        }
+                    }
 
                     MenuItem {
                         readonly property bool visibility : projectBuilder.projectFile !== ""
@@ -1187,6 +1203,8 @@ ApplicationWindow {
 
     property var projectBuilder : ProjectBuilder {
         id: projectBuilder
+        buildJobs: settings.buildJobs
+        failFast: settings.failFastBuild
 
         function isLoadable(file) {
             if (file.name.endsWith(".pro"))
@@ -1227,9 +1245,19 @@ ApplicationWindow {
                 releaseRequested = false
                 runRequested = false
                 debugRequested = false
+                profileRequested = false
                 hud.hudLabel.flashMessage(qsTr("Build finished"))
                 warningSign.flashWarning(qsTr("Build failed"))
             }
+        onBuildStepsTimed:
+            (steps) => {
+                // Slowest steps first, keep the console readable
+                const shown = Math.min(steps.length, 10)
+                for (let i = 0; i < shown; i++) {
+                    const step = steps[i]
+                    consoleView.consoleOutput.append({"content": qsTr("%1 ms: %2").arg(step.duration).arg(step.output), "stdout": true})
+                }
+            }
         onBuildSuccess:
             (debug) => {
                 compiling = false
@@ -1242,6 +1270,7 @@ ApplicationWindow {
                 } else if (runRequested) {
                     root.attemptRun()
                     runRequested = false
+                    profileRequested = false
                 }
 
                 if (releaseRequested) {
@@ -1331,6 +1360,10 @@ ApplicationWindow {
             id: wasmRunner
             system: iosSystem
             forceDebugInterpreter: settings.fallbackInterpreter
+            mapModules: settings.mapModules
+            preallocateMemory: settings.preallocateMemory
+            tieredExecution: settings.tieredExecution
+            tierUpThreshold: settings.tierUpThreshold
             onRunningChanged: {
                 if (running) {
                     hud.hudLabel.flashMessageWithDuration(qsTr("Started"), 1000)
@@ -1353,6 +1386,11 @@ ApplicationWindow {
                     hud.hudLabel.flashMessage(msg);
                 }
 
+            onMetricsReported:
+                (metrics) => {
+                    consoleView.showRunMetrics(metrics)
+                }
+
             onRunEnded:
                 (exitCode) => {
                     if (exitCode === 255) {
@@ -3307,12 +3345,18 @@ ApplicationWindow {
             property bool wiggleHints : true
             property bool wrapEditor : true
             property bool clearConsole: true
+            property int buildJobs : 0
+            property bool failFastBuild : true
             property bool rubberDuck : false
             property bool fallbackInterpreter : false
+            property bool mapModules : true
+            property bool preallocateMemory : false
             property int stackSize : 16
             property int heapSize : 256
             property int threads : 16
             property bool optimizations : platformProperties.supportsOptimizations
+            property bool tieredExecution : true
+            property int tierUpThreshold : 64
             property int sysrootType : SysrootManager.ThreadsNoExceptions
             property bool integratedConsole : false
             property string gitName : ""
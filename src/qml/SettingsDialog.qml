@@ -381,6 +381,29 @@ TideDialog {
                                 }
                             }
                         }
+                        RowLayout {
+                            spacing: paddingMedium
+                            Label {
+                                text: qsTr("Parallel build jobs (0 uses all cores): ")
+                            }
+                            SpinBox {
+                                id: buildJobsTextField
+                                value: settings.buildJobs
+                                from: 0
+                                to: 64
+                                onValueChanged: {
+                                    settings.buildJobs = value
+                                }
+                            }
+                        }
+                        Switch {
+                            id: failFastSwitch
+                            text: qsTr("Stop building on the first error")
+                            checked: settings.failFastBuild
+                            onCheckedChanged: {
+                                settings.failFastBuild = checked
+                            }
+                        }
                     }
                 }
 
@@ -472,6 +495,34 @@ TideDialog {
                                 settings.optimizations = checked
                             }
                         }
+                        Switch {
+                            id: tieredExecutionSwitch
+                            text: qsTr("Tiered execution")
+                            visible: platformProperties.supportsOptimizations
+                            enabled: settings.optimizations
+                            checked: settings.tieredExecution
+                            onCheckedChanged: {
+                                settings.tieredExecution = checked
+                            }
+                        }
+                        RowLayout {
+                            spacing: paddingMedium
+                            visible: platformProperties.supportsOptimizations
+                            enabled: settings.optimizations && settings.tieredExecution
+                            Label {
+                                text: qsTr("Optimize right away below (KB): ")
+                            }
+                            SpinBox {
+                                id: tierUpThresholdTextField
+                                value: settings.tierUpThreshold
+                                from: 0
+                                to: 65536
+                                stepSize: 64
+                                onValueChanged: {
+                                    settings.tierUpThreshold = value
+                                }
+                            }
+                        }
                     }
                 }
 
@@ -603,6 +654,22 @@ TideDialog {
                                 settings.fallbackInterpreter = checked
                             }
                         }
+                        Switch {
+                            id: mapModulesSwitch
+                            text: qsTr("Map programs into memory instead of copying them")
+                            checked: settings.mapModules
+                            onCheckedChanged: {
+                                settings.mapModules = checked
+                            }
+                        }
+                        Switch {
+                            id: preallocateMemorySwitch
+                            text: qsTr("Preallocate program memory and keep it between runs")
+                            checked: settings.preallocateMemory
+                            onCheckedChanged: {
+                                settings.preallocateMemory = checked
+                            }
+                        }
                         Switch {
                             id: clearConsoleSwitch
                             text: qsTr("Clear console output on each run")
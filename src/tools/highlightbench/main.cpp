@@ -0,0 +1,256 @@
+// Runs the editor's syntax highlighter over generated sources without the IDE,
+// timing how long opening, rehighlighting and typing into large files take.
+
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QGuiApplication>
+#include <QTextBlock>
+#include <QTextCursor>
+#include <QTextDocument>
+#include <QTimer>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+#include "editor/qsourcehighliter.h"
+
+struct Corpus {
+    QString name;
+    QSourceHighliter::Language language;
+    QString (*generate)(int lines);
+};
+
+// Every generator repeats a chunk covering what its highlighter has to deal with:
+// keywords, types, literals, comments and strings, nested or spanning lines.
+static QString generateCpp(int lines)
+{
+    static const QStringList chunk {
+        "/*",
+        " * Multiline comment %1, it keeps the following blocks in comment state",
+        " */",
+        "#include <vector>",
+        "#define SCALE_%1 (0x%1 * 2.5e-3f)",
+        "template<typename T>",
+        "class Widget%1 : public Base<T> {",
+        "public:",
+        "    explicit Widget%1(const std::string& name) : m_name(name) {}",
+        "    // Sums everything up, %1 times",
+        "    virtual int64_t sum(const std::vector<T>& values) const override {",
+        "        int64_t ret = 0;",
+        "        for (auto it = values.begin(); it != values.end(); ++it)",
+        "            ret += static_cast<int64_t>(*it) << 2;",
+        "        return ret > 0 ? ret : -1;",
+        "    }",
+        "private:",
+        "    std::string m_name = \"widget %1 \\\"quoted\\\"\";",
+        "    const char m_separator = '\\n';",
+        "};",
+        "",
+    };
+
+    QString ret;
+    for (int i = 0; i < lines; i++)
+        ret += chunk[i % chunk.size()].arg(i / chunk.size()) + '\n';
+    return ret;
+}
+
+static QString generatePython(int lines)
+{
+    static const QStringList chunk {
+        "# Comment %1",
+        "import os",
+        "from collections import defaultdict",
+        "",
+        "class Handler%1(object):",
+        "    \"\"\"Docstring of handler %1\"\"\"",
+        "",
+        "    def __init__(self, name='handler_%1', retries=0x%1):",
+        "        self.name = name",
+        "        self.values = [1, 2.5, 3e10, None, True, False]",
+        "",
+        "    @property",
+        "    def label(self):",
+        "        return f\"{self.name}: {len(self.values)} values\"",
+        "",
+        "    def run(self, *args, **kwargs):",
+        "        for index, value in enumerate(args):",
+        "            if value is not None and index % 2 == 0:",
+        "                yield os.path.join(self.name, str(value))",
+        "        raise StopIteration('done %1')",
+        "",
+    };
+
+    QString ret;
+    for (int i = 0; i < lines; i++)
+        ret += chunk[i % chunk.size()].arg(i / chunk.size()) + '\n';
+    return ret;
+}
+
+static QString generateJson(int lines)
+{
+    static const QStringList chunk {
+        "    {",
+        "        \"id\": %1,",
+        "        \"name\": \"entry %1 with \\\"escapes\\\"\",",
+        "        \"enabled\": true,",
+        "        \"ratio\": -%1.25e-3,",
+        "        \"parent\": null,",
+        "        \"tags\": [\"alpha\", \"beta\", \"gamma\"],",
+        "        \"nested\": { \"depth\": 2, \"values\": [1, 2, 3] }",
+        "    },",
+    };
+
+    QString ret = "[\n";
+    for (int i = 0; i < lines - 2; i++)
+        ret += chunk[i % chunk.size()].arg(i / chunk.size()) + '\n';
+    return ret + "    {}\n]\n";
+}
+
+static const std::vector<Corpus> corpora {
+    { "cpp", QSourceHighliter::CodeCpp, generateCpp },
+    { "python", QSourceHighliter::CodePython, generatePython },
+    { "json", QSourceHighliter::CodeJSON, generateJson },
+};
+
+static constexpr int KeystrokesPerIteration = 20;
+
+struct Timing {
+    double syncMs = 0;
+    double settledMs = 0;
+    int blocks = 0;
+};
+
+// Runs action and the event loop until the highlighter reports that nothing is pending
+static Timing measure(QSourceHighliter& highlighter, const std::function<void()>& action)
+{
+    Timing ret;
+    QEventLoop loop;
+    QTimer timeout;
+    timeout.setSingleShot(true);
+    QObject::connect(&timeout, &QTimer::timeout, &loop, &QEventLoop::quit);
+    const auto connection = QObject::connect(&highlighter, &QSourceHighliter::blocksRehighlighted,
+                                             &loop, [&](int count) {
+        ret.blocks = count;
+        loop.quit();
+    });
+
+    QElapsedTimer timer;
+    timer.start();
+    action();
+    ret.syncMs = timer.nsecsElapsed() / 1000000.0;
+
+    timeout.start(60 * 1000);
+    loop.exec();
+    ret.settledMs = timer.nsecsElapsed() / 1000000.0;
+
+    QObject::disconnect(connection);
+    return ret;
+}
+
+// Nearest rank, values have to be sorted
+static double percentile(const std::vector<double>& values, const double p)
+{
+    if (values.empty())
+        return 0;
+    const size_t rank = (size_t)std::ceil(p * values.size());
+    return values[std::min(values.size(), std::max<size_t>(rank, 1)) - 1];
+}
+
+static double median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    return percentile(values, 0.5);
+}
+
+int main(int argc, char** argv)
+{
+    // No window is ever shown, a display isn't needed
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QGuiApplication app(argc, argv);
+    QGuiApplication::setApplicationName("tide-highlightbench");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Times the syntax highlighter on generated C++, Python and JSON sources.");
+    parser.addHelpOption();
+    const QCommandLineOption iterationsOption({ "n", "iterations" }, "Runs per measurement (default 5).", "N", "5");
+    const QCommandLineOption linesOption({ "l", "lines" }, "Lines per generated source (default 50000).", "N", "50000");
+    const QCommandLineOption languagesOption({ "L", "languages" }, "Comma separated, out of cpp,python,json.", "LIST");
+    parser.addOption(iterationsOption);
+    parser.addOption(linesOption);
+    parser.addOption(languagesOption);
+    parser.process(app);
+
+    const int iterations = parser.value(iterationsOption).toInt();
+    const int lines = parser.value(linesOption).toInt();
+    const QStringList languages = parser.isSet(languagesOption) ?
+                parser.value(languagesOption).split(',') : QStringList();
+    if (iterations <= 0 || lines <= 2)
+        parser.showHelp(2);
+
+    for (const auto& language : languages) {
+        const auto known = std::find_if(corpora.begin(), corpora.end(), [&language](const Corpus& corpus) {
+            return corpus.name == language;
+        });
+        if (known == corpora.end()) {
+            fprintf(stderr, "Unknown language '%s'\n", qPrintable(language));
+            return 2;
+        }
+    }
+
+    // open, settled: setting the whole text, its synchronous part and until everything is highlighted
+    // rehl:          a full incremental rehighlight, as after switching the theme or language
+    // key, blocks:   typing a character in the middle, the synchronous part and the blocks it touched
+    printf("%-8s%8s%12s%12s%12s%12s%12s%10s\n",
+           "lang", "lines", "open ms", "settled ms", "rehl ms", "key ms", "key p99", "blocks");
+
+    for (const auto& corpus : corpora) {
+        if (!languages.isEmpty() && !languages.contains(corpus.name))
+            continue;
+
+        const QString text = corpus.generate(lines);
+        std::vector<double> openSync, openSettled, rehighlight, keystroke;
+        int keystrokeBlocks = 0;
+
+        for (int iteration = 0; iteration < iterations; iteration++) {
+            QTextDocument doc;
+            QSourceHighliter highlighter(&doc, QSourceHighliter::Monokai);
+            highlighter.setCurrentLanguage(corpus.language);
+
+            // QSyntaxHighlighter ignores edits until its initial, queued rehighlight ran
+            QEventLoop idle;
+            QTimer::singleShot(50, &idle, &QEventLoop::quit);
+            idle.exec();
+
+            const Timing open = measure(highlighter, [&]() { doc.setPlainText(text); });
+            openSync.push_back(open.syncMs);
+            openSettled.push_back(open.settledMs);
+
+            rehighlight.push_back(measure(highlighter, [&]() {
+                highlighter.rehighlightIncrementally();
+            }).settledMs);
+
+            QTextCursor cursor(doc.findBlockByNumber(doc.blockCount() / 2));
+            cursor.movePosition(QTextCursor::EndOfBlock);
+            for (int i = 0; i < KeystrokesPerIteration; i++) {
+                const Timing key = measure(highlighter, [&]() { cursor.insertText("x"); });
+                keystroke.push_back(key.syncMs);
+                keystrokeBlocks = std::max(keystrokeBlocks, key.blocks);
+            }
+        }
+
+        std::sort(keystroke.begin(), keystroke.end());
+        printf("%-8s%8d%12.2f%12.2f%12.2f%12.3f%12.3f%10d\n",
+               qPrintable(corpus.name), lines,
+               median(openSync), median(openSettled), median(rehighlight),
+               percentile(keystroke, 0.5), percentile(keystroke, 0.99), keystrokeBlocks);
+        fflush(stdout);
+    }
+
+    return 0;
+}
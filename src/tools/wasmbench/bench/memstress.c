@@ -0,0 +1,75 @@
+// Load and store heavy workload for comparing software and hardware bounds checks.
+// Nearly every instruction of the loops below touches linear memory, so the cost of
+// the check in front of each access dominates the run time.
+//
+// Build it with the Wasi SDK:
+//   clang --target=wasm32-wasi -O2 -o memstress.wasm memstress.c
+//
+// Compare the fast interpreter with and without hardware bounds checks:
+//   tide-wasmbench -m fast,fasthw -n 5 memstress.wasm
+//
+// The buffer size in MB can be passed after "--", e.g. "-- 4" to stay within the CPU caches.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DEFAULT_SIZE_MB 32
+#define ROUNDS 2
+
+// Sequential stores, loads and copies
+static uint64_t stream(uint32_t* buf, uint32_t* copy, size_t count)
+{
+    uint64_t sum = 0;
+    for (size_t i = 0; i < count; i++)
+        buf[i] = (uint32_t)(i * 2654435761u);
+    memcpy(copy, buf, count * sizeof(uint32_t));
+    for (size_t i = 0; i < count; i++)
+        sum += copy[i] ^ buf[count - 1 - i];
+    return sum;
+}
+
+// Dependent random reads and writes, defeating the prefetcher
+static uint64_t scatter(uint32_t* buf, size_t count)
+{
+    uint64_t sum = 0;
+    uint32_t state = 0x9e3779b9u;
+    for (size_t i = 0; i < count; i++) {
+        state = state * 1664525u + 1013904223u;
+        const size_t index = (state ^ buf[state % count]) % count;
+        buf[index] += (uint32_t)i;
+        sum += buf[index];
+    }
+    return sum;
+}
+
+int main(int argc, char** argv)
+{
+    const size_t sizeMb = argc > 1 ? strtoul(argv[1], NULL, 10) : DEFAULT_SIZE_MB;
+    const size_t count = sizeMb * 1024 * 1024 / sizeof(uint32_t);
+    if (count == 0) {
+        fprintf(stderr, "Invalid buffer size\n");
+        return 2;
+    }
+
+    uint32_t* buf = malloc(count * sizeof(uint32_t));
+    uint32_t* copy = malloc(count * sizeof(uint32_t));
+    if (!buf || !copy) {
+        fprintf(stderr, "Failed to allocate %zu MB twice\n", sizeMb);
+        return 1;
+    }
+
+    uint64_t sum = 0;
+    for (int round = 0; round < ROUNDS; round++) {
+        sum += stream(buf, copy, count);
+        sum += scatter(buf, count);
+    }
+
+    // Printing the result keeps the loops from being optimized away
+    printf("%llu\n", (unsigned long long)sum);
+
+    free(copy);
+    free(buf);
+    return 0;
+}
@@ -0,0 +1,542 @@
+// Runs WebAssembly binaries through the runner libraries without the IDE,
+// timing each run mode so runtime changes can be checked for regressions in CI.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "common/wasmrunnerinterface.h"
+
+namespace fs = std::filesystem;
+
+struct RunMode {
+    std::string name;
+    std::string library;
+    WasmRunnerConfigFlags flags;
+};
+
+static const std::vector<RunMode> runModes {
+    { "debug", "Wasmrunner", WasmRunnerConfigFlags::None },
+    { "fast", "Wasmrunnerfast", WasmRunnerConfigFlags::None },
+    { "fasthw", "Wasmrunnerfasthw", WasmRunnerConfigFlags::None },
+    { "jit", "Wasmrunnerjit", WasmRunnerConfigFlags::JIT },
+    { "tiered", "Wasmrunnerjit", (WasmRunnerConfigFlags)(WasmRunnerConfigFlags::JIT | WasmRunnerConfigFlags::Tiered) },
+    { "aot", "Wasmrunnerjit", (WasmRunnerConfigFlags)(WasmRunnerConfigFlags::JIT | WasmRunnerConfigFlags::AOT) },
+};
+
+struct Options {
+    unsigned int iterations = 10;
+    unsigned int jobs = std::max(1u, std::thread::hardware_concurrency());
+    unsigned int stackSize = 16;
+    unsigned int heapSize = 256;
+    unsigned int threads = 16;
+    bool mmap = true;
+    bool compareMmap = false;
+    bool cold = false;
+    bool pool = false;
+    bool verbose = false;
+    std::string libsDir;
+    std::string jsonPath;
+    std::vector<std::string> modes;
+    std::string target;
+    std::vector<std::string> args;
+};
+
+struct RunResult {
+    double wallMs = 0;
+    uint64_t rss = 0;
+    WasmRunMetrics metrics;
+    bool hasMetrics = false;
+    int exitCode = -1;
+    std::string error;
+};
+
+struct BenchResult {
+    std::string binary;
+    std::string mode;
+    bool mmap = true;
+    std::vector<RunResult> runs;
+};
+
+// Collects what a runner reports during a single run
+class BenchHost : public WasmRunnerHost
+{
+public:
+    virtual void report(const std::string& msg) override
+    {
+        (void)msg;
+    }
+
+    virtual void reportError(const std::string& err) override
+    {
+        result.error = err;
+    }
+
+    virtual void reportExit(const int code) override
+    {
+        result.exitCode = code;
+    }
+
+    virtual void reportDebugPort(const uint32_t debugPort) override
+    {
+        (void)debugPort;
+    }
+
+    virtual void reportMetrics(const WasmRunMetrics& metrics) override
+    {
+        result.metrics = metrics;
+        result.hasMetrics = true;
+    }
+
+    RunResult result;
+};
+
+// Runner libraries print progress to stdout, results go to the original one
+static FILE* output = stdout;
+
+static void usage(const char* name)
+{
+    std::cerr << "Usage: " << name << " [options] <binary.wasm | directory> [-- args...]\n"
+              << "\n"
+              << "Runs a binary, or every .wasm binary below a directory, N times per run mode\n"
+              << "and reports min/median/p99 wall time, median load time, peak linear memory\n"
+              << "and the resident memory a run added to the process at its peak.\n"
+              << "\n"
+              << "  -n, --iterations N   Runs per binary and mode (default 10)\n"
+              << "  -m, --modes LIST     Comma separated, out of debug,fast,fasthw,jit,tiered,aot\n"
+              << "                       (default: every mode whose runner library is installed)\n"
+              << "  -j, --jobs N         Binaries run in parallel (default: number of CPUs)\n"
+              << "  -L, --libs DIR       Directory containing the runner libraries\n"
+              << "  --stack MB           Stack size (default 16)\n"
+              << "  --heap MB            Heap size (default 256)\n"
+              << "  --threads N          Maximum guest thread count (default 16)\n"
+              << "  --no-mmap            Read binaries instead of mapping them\n"
+              << "  --compare-mmap       Run every mode with and without mapping binaries, cold and\n"
+              << "                       one binary at a time so resident memory stays per run\n"
+              << "  --cold               Load binaries anew on every run instead of reusing the\n"
+              << "                       modules the runners keep cached between runs\n"
+              << "  --pool               Allocate guest memory from a preallocated pool\n"
+              << "  --json FILE          Write all results as JSON\n"
+              << "  -v, --verbose        Keep the output of the runners and binaries\n";
+}
+
+static std::string defaultLibsDir(const char* argv0)
+{
+    char path[PATH_MAX];
+#ifdef __linux__
+    const ssize_t length = readlink("/proc/self/exe", path, sizeof(path) - 1);
+    if (length > 0) {
+        path[length] = '\0';
+        return (fs::path(path).parent_path() / ".." / "lib").string();
+    }
+#endif
+    if (realpath(argv0, path))
+        return (fs::path(path).parent_path() / ".." / "lib").string();
+    return "../lib";
+}
+
+static std::string libraryPath(const Options& options, const std::string& library)
+{
+#if __APPLE__
+    return options.libsDir + "/Frameworks/Tide-" + library + ".framework/Tide-" + library;
+#else
+    return options.libsDir + "/libtide-" + library + ".so";
+#endif
+}
+
+static bool parseNumber(const char* str, unsigned int* ret)
+{
+    char* end = nullptr;
+    const unsigned long value = strtoul(str, &end, 10);
+    if (!end || *end != '\0' || value == 0 || value > UINT_MAX)
+        return false;
+    *ret = (unsigned int)value;
+    return true;
+}
+
+static bool parseOptions(int argc, char** argv, Options* options)
+{
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        if (arg == "--") {
+            for (i++; i < argc; i++)
+                options->args.push_back(argv[i]);
+            break;
+        } else if ((arg == "-n" || arg == "--iterations") && hasValue) {
+            if (!parseNumber(argv[++i], &options->iterations))
+                return false;
+        } else if ((arg == "-j" || arg == "--jobs") && hasValue) {
+            if (!parseNumber(argv[++i], &options->jobs))
+                return false;
+        } else if ((arg == "-m" || arg == "--modes") && hasValue) {
+            std::stringstream modes(argv[++i]);
+            std::string mode;
+            while (std::getline(modes, mode, ','))
+                options->modes.push_back(mode);
+        } else if ((arg == "-L" || arg == "--libs") && hasValue) {
+            options->libsDir = argv[++i];
+        } else if (arg == "--stack" && hasValue) {
+            if (!parseNumber(argv[++i], &options->stackSize))
+                return false;
+        } else if (arg == "--heap" && hasValue) {
+            if (!parseNumber(argv[++i], &options->heapSize))
+                return false;
+        } else if (arg == "--threads" && hasValue) {
+            if (!parseNumber(argv[++i], &options->threads))
+                return false;
+        } else if (arg == "--no-mmap") {
+            options->mmap = false;
+        } else if (arg == "--compare-mmap") {
+            options->compareMmap = true;
+            options->cold = true;
+        } else if (arg == "--cold") {
+            options->cold = true;
+        } else if (arg == "--pool") {
+            options->pool = true;
+        } else if (arg == "--json" && hasValue) {
+            options->jsonPath = argv[++i];
+        } else if (arg == "-v" || arg == "--verbose") {
+            options->verbose = true;
+        } else if (!arg.empty() && arg[0] != '-' && options->target.empty()) {
+            options->target = arg;
+        } else {
+            return false;
+        }
+    }
+
+    return !options->target.empty();
+}
+
+static std::vector<std::string> collectBinaries(const std::string& target)
+{
+    std::vector<std::string> ret;
+
+    std::error_code error;
+    if (!fs::is_directory(target, error)) {
+        ret.push_back(target);
+        return ret;
+    }
+
+    for (const auto& entry : fs::recursive_directory_iterator(target, error)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".wasm")
+            ret.push_back(entry.path().string());
+    }
+
+    std::sort(ret.begin(), ret.end());
+    return ret;
+}
+
+// Field of /proc/self/status in bytes, 0 where there is none
+static uint64_t procStatus(const char* field)
+{
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    const size_t length = strlen(field);
+    while (std::getline(status, line)) {
+        if (line.compare(0, length, field) == 0 && line.size() > length && line[length] == ':')
+            return strtoull(line.c_str() + length + 1, nullptr, 10) * 1024;
+    }
+#else
+    (void)field;
+#endif
+    return 0;
+}
+
+// Lets VmHWM start over from the current resident size
+static void resetPeakRss()
+{
+#ifdef __linux__
+    const int fd = open("/proc/self/clear_refs", O_WRONLY);
+    if (fd < 0)
+        return;
+    const ssize_t written = write(fd, "5", 1);
+    (void)written;
+    close(fd);
+#endif
+}
+
+static RunResult runOnce(const std::shared_ptr<wamr_runtime>& lib, const WasmRunnerConfig& config,
+                         const std::string& binary, const Options& options)
+{
+    BenchHost host;
+
+    std::vector<const char*> argv { binary.c_str() };
+    for (const auto& arg : options.args)
+        argv.push_back(arg.c_str());
+
+    // The runtime takes ownership of the descriptors it is handed
+    const int quiet = open("/dev/null", O_RDWR);
+    const int infd = options.verbose ? dup(STDIN_FILENO) : dup(quiet);
+    const int outfd = options.verbose ? dup(fileno(output)) : dup(quiet);
+    const int errfd = options.verbose ? dup(STDERR_FILENO) : dup(quiet);
+    close(quiet);
+
+    // Overlapping runs share the process, their resident memory can't be told apart
+    resetPeakRss();
+    const uint64_t rssBefore = procStatus("VmRSS");
+    const auto startTime = std::chrono::steady_clock::now();
+
+    WasmRuntime runtime = lib->init(&host, (WasmRuntimeConfig)&config);
+    lib->start(runtime, binary.c_str(), argv.size(), (char**)argv.data(),
+               infd, outfd, errfd, false, "/::/");
+    lib->destroy(runtime);
+
+    host.result.wallMs = std::chrono::duration_cast<std::chrono::microseconds>(
+                             std::chrono::steady_clock::now() - startTime).count() / 1000.0;
+
+    const uint64_t rssPeak = procStatus("VmHWM");
+    host.result.rss = rssPeak > rssBefore ? rssPeak - rssBefore : 0;
+    return host.result;
+}
+
+// Nearest rank, values have to be sorted
+static double percentile(const std::vector<double>& values, const double p)
+{
+    if (values.empty())
+        return 0;
+    const size_t rank = (size_t)std::ceil(p * values.size());
+    return values[std::min(values.size(), std::max<size_t>(rank, 1)) - 1];
+}
+
+static bool failed(const RunResult& run)
+{
+    return !run.error.empty() || run.exitCode != 0;
+}
+
+static void printResult(const BenchResult& result)
+{
+    std::vector<double> wall;
+    std::vector<double> load;
+    uint64_t peakMemory = 0;
+    uint64_t rss = 0;
+    size_t failures = 0;
+    std::string error;
+
+    for (const auto& run : result.runs) {
+        wall.push_back(run.wallMs);
+        load.push_back(run.metrics.loadMs);
+        peakMemory = std::max(peakMemory, run.metrics.peakMemory);
+        rss = std::max(rss, run.rss);
+        if (failed(run)) {
+            failures++;
+            if (error.empty())
+                error = !run.error.empty() ? run.error : "exit code " + std::to_string(run.exitCode);
+        }
+    }
+    std::sort(wall.begin(), wall.end());
+    std::sort(load.begin(), load.end());
+
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(2)
+         << std::left << std::setw(12) << result.mode + (result.mmap ? "" : "/read") << std::right
+         << std::setw(12) << (wall.empty() ? 0.0 : wall.front())
+         << std::setw(12) << percentile(wall, 0.5)
+         << std::setw(12) << percentile(wall, 0.99)
+         << std::setw(12) << percentile(load, 0.5)
+         << std::setw(12) << std::setprecision(1) << peakMemory / 1024.0 / 1024.0
+         << std::setw(12) << rss / 1024.0 / 1024.0
+         << "  " << result.binary;
+    if (failures > 0)
+        line << " (" << failures << "/" << result.runs.size() << " failed: " << error << ")";
+
+    fprintf(output, "%s\n", line.str().c_str());
+}
+
+static std::string jsonString(const std::string& str)
+{
+    std::string ret = "\"";
+    for (const char c : str) {
+        if (c == '"' || c == '\\') {
+            ret += '\\';
+            ret += c;
+        } else if ((unsigned char)c < 0x20) {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            ret += escaped;
+        } else {
+            ret += c;
+        }
+    }
+    return ret + "\"";
+}
+
+static bool writeJson(const std::string& path, const std::vector<BenchResult>& results)
+{
+    std::ofstream json(path, std::ios::trunc);
+    if (!json.is_open())
+        return false;
+
+    json << "{\n  \"results\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& result = results[i];
+        json << (i > 0 ? "," : "") << "\n    {\n"
+             << "      \"binary\": " << jsonString(result.binary) << ",\n"
+             << "      \"mode\": " << jsonString(result.mode) << ",\n"
+             << "      \"mmap\": " << (result.mmap ? "true" : "false") << ",\n"
+             << "      \"runs\": [";
+        for (size_t j = 0; j < result.runs.size(); j++) {
+            const auto& run = result.runs[j];
+            json << (j > 0 ? ", " : "") << "{"
+                 << "\"wallMs\": " << run.wallMs << ", "
+                 << "\"loadMs\": " << run.metrics.loadMs << ", "
+                 << "\"instantiateMs\": " << run.metrics.instantiateMs << ", "
+                 << "\"mainMs\": " << run.metrics.mainMs << ", "
+                 << "\"peakMemory\": " << run.metrics.peakMemory << ", "
+                 << "\"pagesGrown\": " << run.metrics.pagesGrown << ", "
+                 << "\"threadCount\": " << run.metrics.threadCount << ", "
+                 << "\"rss\": " << run.rss << ", "
+                 << "\"exitCode\": " << run.exitCode << ", "
+                 << "\"error\": " << jsonString(run.error) << "}";
+        }
+        json << "]\n    }";
+    }
+    json << "\n  ]\n}\n";
+    return json.good();
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, &options)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if (options.libsDir.empty())
+        options.libsDir = defaultLibsDir(argv[0]);
+
+    for (const auto& name : options.modes) {
+        const auto known = std::find_if(runModes.begin(), runModes.end(), [&name](const RunMode& mode) {
+            return mode.name == name;
+        });
+        if (known == runModes.end()) {
+            std::cerr << "Unknown run mode '" << name << "'" << std::endl;
+            return 2;
+        }
+    }
+
+    std::vector<RunMode> modes;
+    for (const auto& mode : runModes) {
+        const bool requested = options.modes.empty() ||
+                               std::find(options.modes.begin(), options.modes.end(), mode.name) != options.modes.end();
+        if (!requested)
+            continue;
+
+        if (access(libraryPath(options, mode.library).c_str(), R_OK) != 0) {
+            if (!options.modes.empty()) {
+                std::cerr << "Runner library for mode '" << mode.name << "' not found in " << options.libsDir << std::endl;
+                return 2;
+            }
+            continue;
+        }
+        modes.push_back(mode);
+    }
+    if (modes.empty()) {
+        std::cerr << "No runner libraries found in " << options.libsDir << std::endl;
+        return 2;
+    }
+
+    const auto binaries = collectBinaries(options.target);
+    if (binaries.empty()) {
+        std::cerr << "No binaries found in " << options.target << std::endl;
+        return 2;
+    }
+
+    // Keep the chatter of the runners out of the results
+    output = fdopen(dup(STDOUT_FILENO), "w");
+    if (!options.verbose) {
+        const int quiet = open("/dev/null", O_WRONLY);
+        dup2(quiet, STDOUT_FILENO);
+        close(quiet);
+    }
+
+    fprintf(output, "%-12s%12s%12s%12s%12s%12s%12s  %s\n",
+            "mode", "min ms", "median ms", "p99 ms", "load ms", "peak MB", "rss MB", "binary");
+    fflush(output);
+
+    std::vector<BenchResult> results;
+    std::mutex resultsMutex;
+    bool anyFailed = false;
+
+    // Modes one after another: a runner library only switches its runtime's
+    // configuration while no run is in flight.
+    for (const auto& mode : modes) {
+        const auto lib = wamr_runtime_load(libraryPath(options, mode.library).c_str());
+        if (!lib->handle || !lib->init || !lib->start || !lib->destroy) {
+            std::cerr << "Failed to load runner library for mode '" << mode.name << "'" << std::endl;
+            anyFailed = true;
+            continue;
+        }
+
+        const std::vector<bool> mmapVariants = options.compareMmap ? std::vector<bool> { true, false }
+                                                                   : std::vector<bool> { options.mmap };
+        for (const bool mmap : mmapVariants) {
+            WasmRunnerConfig config;
+            config.stackSize = options.stackSize * 1024 * 1024;
+            config.heapSize = options.heapSize * 1024 * 1024;
+            config.threadCount = options.threads;
+            config.tierUpThreshold = 64;
+            config.flags = mode.flags;
+            if (mmap)
+                config.flags = (WasmRunnerConfigFlags)(config.flags | WasmRunnerConfigFlags::Mmap);
+            if (options.pool)
+                config.flags = (WasmRunnerConfigFlags)(config.flags | WasmRunnerConfigFlags::Pool);
+            if (options.cold)
+                config.flags = (WasmRunnerConfigFlags)(config.flags | WasmRunnerConfigFlags::NoModuleCache);
+
+            std::atomic<size_t> next { 0 };
+            std::vector<std::thread> workers;
+            const unsigned int jobs = options.compareMmap ? 1 : std::min<unsigned int>(options.jobs, binaries.size());
+
+            for (unsigned int job = 0; job < jobs; job++) {
+                workers.emplace_back([&]() {
+                    for (size_t i = next++; i < binaries.size(); i = next++) {
+                        BenchResult result;
+                        result.binary = binaries[i];
+                        result.mode = mode.name;
+                        result.mmap = mmap;
+                        for (unsigned int iteration = 0; iteration < options.iterations; iteration++)
+                            result.runs.push_back(runOnce(lib, config, binaries[i], options));
+
+                        std::lock_guard<std::mutex> lock(resultsMutex);
+                        printResult(result);
+                        fflush(output);
+                        anyFailed |= std::any_of(result.runs.begin(), result.runs.end(), failed);
+                        results.push_back(std::move(result));
+                    }
+                });
+            }
+
+            for (auto& worker : workers)
+                worker.join();
+        }
+    }
+
+    if (!options.jsonPath.empty() && !writeJson(options.jsonPath, results)) {
+        std::cerr << "Failed to write " << options.jsonPath << std::endl;
+        return 1;
+    }
+
+    return anyFailed ? 1 : 0;
+}
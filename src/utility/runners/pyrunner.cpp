@@ -134,6 +134,12 @@ void TidePyRunnerHost::reportDebugPort(const uint32_t port)
 #endif
 }
 
+void TidePyRunnerHost::reportMetrics(const WasmRunMetrics& metrics)
+{
+    // The interpreter's own startup is of no interest for scripts
+    Q_UNUSED(metrics)
+}
+
 void PyRunner::run(const QString binary, const QStringList args)
 {
     start(binary, args, false);
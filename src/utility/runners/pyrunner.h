@@ -39,6 +39,7 @@ public:
     virtual void reportError(const std::string& err) override;
     virtual void reportExit(const int code) override;
     virtual void reportDebugPort(const uint32_t debugPort) override;
+    virtual void reportMetrics(const WasmRunMetrics& metrics) override;
     PyRunner* runner;
 };
 
@@ -3,11 +3,17 @@
 #include <QObject>
 #include <QCoreApplication>
 #include <QDebug>
+#include <QElapsedTimer>
 #include <QFile>
 #include <QFileInfo>
+#include <QDateTime>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QStandardPaths>
 #include <QString>
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <fstream>
@@ -18,6 +24,10 @@
 #include <stdio.h>
 #include <signal.h>
 
+#ifdef Q_OS_LINUX
+#include <sys/resource.h>
+#endif
+
 #include "debugger.h"
 
 #include <pthread.h>
@@ -29,7 +39,7 @@
 
 WasmRunner::WasmRunner(QObject *parent)
     : QObject{parent}, m_running{false}, m_system{nullptr}, m_debugger{nullptr},
-    m_runnerHost{new TideWasmRunnerHost(this)}
+    m_mapModules{true}, m_preallocateMemory{false}, m_tieredExecution{true}, m_tierUpThreshold{64}, m_runnerHost{new TideWasmRunnerHost(this)}
 {
 }
 
@@ -118,6 +128,46 @@ void TideWasmRunnerHost::reportDebugPort(const uint32_t port)
     }
 }
 
+// Every run is appended to <binary>.metrics.json next to the binary,
+// so runs before and after a change can be compared outside of Tide.
+void TideWasmRunnerHost::reportMetrics(const WasmRunMetrics& metrics)
+{
+    static constexpr int MaxRecordedRuns = 100;
+
+    const auto& shared = runner->sharedData;
+
+    QVariantMap ret;
+    ret.insert("binary", shared.binary);
+    ret.insert("runner", shared.runnerName);
+    ret.insert("flags", (int)shared.config.flags);
+    ret.insert("timestamp", QDateTime::currentDateTimeUtc().toString(Qt::ISODateWithMs));
+    ret.insert("loadMs", metrics.loadMs);
+    ret.insert("instantiateMs", metrics.instantiateMs);
+    ret.insert("mainMs", metrics.mainMs);
+    ret.insert("peakMemory", (qint64)metrics.peakMemory);
+    ret.insert("pagesGrown", metrics.pagesGrown);
+    ret.insert("threadCount", metrics.threadCount);
+
+    QFile metricsFile(shared.binary + QStringLiteral(".metrics.json"));
+    QJsonArray runs;
+    if (metricsFile.open(QFile::ReadOnly)) {
+        runs = QJsonDocument::fromJson(metricsFile.readAll()).object().value("runs").toArray();
+        metricsFile.close();
+    }
+
+    runs.append(QJsonObject::fromVariantMap(ret));
+    while (runs.size() > MaxRecordedRuns)
+        runs.removeFirst();
+
+    if (metricsFile.open(QFile::WriteOnly | QFile::Truncate)) {
+        metricsFile.write(QJsonDocument(QJsonObject {{"runs", runs}}).toJson());
+    } else {
+        qWarning() << "Failed to write run metrics to" << metricsFile.fileName();
+    }
+
+    emit runner->metricsReported(ret);
+}
+
 void WasmRunner::configure(unsigned int stack, unsigned int heap, unsigned int threads, bool opt)
 {
     if (stack <= 0)
@@ -132,9 +182,14 @@ void WasmRunner::configure(unsigned int stack, unsigned int heap, unsigned int t
     // Enable certain properties the WasmRunner plugin should attempt to do,
     // but might fail depending on various reasons (platform capabilities, init failure)
     // and fall back to a working default. That means plugins might take this as a hint.
-    if (opt)
+    if (opt) {
+#ifdef Q_OS_LINUX
+        // Compiled ahead of time once per binary and CPU, cached next to the binary
+        sharedData.config.flags = (WasmRunnerConfigFlags)(WasmRunnerConfigFlags::JIT | WasmRunnerConfigFlags::AOT);
+#else
         sharedData.config.flags = WasmRunnerConfigFlags::JIT;
-    else
+#endif
+    } else
         sharedData.config.flags = WasmRunnerConfigFlags::None;
 }
 
@@ -148,6 +203,17 @@ void WasmRunner::debug(const QString binary, const QStringList args, const bool
     start(binary, args, true, exceptions);
 }
 
+void WasmRunner::profile(const QString binary, const QStringList args, const bool exceptions)
+{
+    // The sampler lives in the fast interpreter, which is built without exception handling
+    if (exceptions) {
+        emit errorOccured(tr("Profiling is not available for projects using exceptions"));
+        return;
+    }
+
+    start(binary, args, false, exceptions, true);
+}
+
 void WasmRunner::waitForFinished()
 {
     std::lock_guard<std::mutex> lk(sharedData.runMutex);
@@ -160,18 +226,48 @@ int WasmRunner::exitCode()
     return this->sharedData.main_result;
 }
 
-void WasmRunner::start(const QString binary, const QStringList args, const bool debug, const bool exceptions)
+#ifdef Q_OS_LINUX
+// Guard regions reserve 8GB of address space per linear memory,
+// a limited address space would make instantiation fail instead.
+static bool hardwareBoundsCheckUsable()
 {
+#if defined(Q_PROCESSOR_X86_64) || defined(Q_PROCESSOR_ARM_64)
+    static constexpr rlim_t RequiredAddressSpace = 64ULL * 1024 * 1024 * 1024;
+
+    struct rlimit limit;
+    if (getrlimit(RLIMIT_AS, &limit) != 0)
+        return false;
+    return limit.rlim_cur == RLIM_INFINITY || limit.rlim_cur >= RequiredAddressSpace;
+#else
+    return false;
+#endif
+}
+#endif
+
+void WasmRunner::start(const QString binary, const QStringList args, const bool debug, const bool exceptions, const bool profile)
+{
+    // Profiling walks the interpreter's frames, so it always runs in the fast interpreter
     QString wasmRunner = QStringLiteral("Wasmrunnerfast");
-    if (m_forceDebugInterpreter || debug || exceptions) {
+    if (!profile && (m_forceDebugInterpreter || debug || exceptions)) {
         wasmRunner = QStringLiteral("Wasmrunner");
-    } else if (sharedData.config.flags & JIT) {
+    } else if (!profile && (sharedData.config.flags & JIT)) {
         wasmRunner = QStringLiteral("Wasmrunnerjit");
     }
 
     QString applicationFile = binary;
     qDebug() << "Running" << applicationFile << args << debug;
 
+    QElapsedTimer startupTimer;
+    startupTimer.start();
+
+    // Reap the previous run, its runtime instance is not needed anymore
+    if (sharedData.running)
+        waitForFinished();
+    if (sharedData.runtime && sharedData.lib && sharedData.lib->destroy) {
+        sharedData.lib->destroy(sharedData.runtime);
+    }
+    sharedData.runtime = nullptr;
+
     sharedData.binary = applicationFile;
     sharedData.args = args;
     sharedData.main_result = -1;
@@ -181,6 +277,30 @@ void WasmRunner::start(const QString binary, const QStringList args, const bool
     sharedData.debugger = m_debugger;
     sharedData.runner = this;
 
+    // Loading is done zero-copy from a private mapping of the binary if requested
+    if (m_mapModules)
+        sharedData.config.flags = (WasmRunnerConfigFlags)(sharedData.config.flags | WasmRunnerConfigFlags::Mmap);
+    else
+        sharedData.config.flags = (WasmRunnerConfigFlags)(sharedData.config.flags & ~WasmRunnerConfigFlags::Mmap);
+
+    if (profile)
+        sharedData.config.flags = (WasmRunnerConfigFlags)(sharedData.config.flags | WasmRunnerConfigFlags::Profile);
+    else
+        sharedData.config.flags = (WasmRunnerConfigFlags)(sharedData.config.flags & ~WasmRunnerConfigFlags::Profile);
+
+    // Guest memory comes from an arena kept around between runs instead of malloc
+    if (m_preallocateMemory)
+        sharedData.config.flags = (WasmRunnerConfigFlags)(sharedData.config.flags | WasmRunnerConfigFlags::Pool);
+    else
+        sharedData.config.flags = (WasmRunnerConfigFlags)(sharedData.config.flags & ~WasmRunnerConfigFlags::Pool);
+
+    // Optimized runs start out in a baseline JIT and move to LLVM code per function
+    if (m_tieredExecution && (sharedData.config.flags & WasmRunnerConfigFlags::JIT))
+        sharedData.config.flags = (WasmRunnerConfigFlags)(sharedData.config.flags | WasmRunnerConfigFlags::Tiered);
+    else
+        sharedData.config.flags = (WasmRunnerConfigFlags)(sharedData.config.flags & ~WasmRunnerConfigFlags::Tiered);
+    sharedData.config.tierUpThreshold = std::max(0, m_tierUpThreshold);
+
     std::string runnerPath;
 
 #ifdef Q_OS_IOS
@@ -192,6 +312,13 @@ void WasmRunner::start(const QString binary, const QStringList args, const bool
 #endif
 
 #ifdef Q_OS_LINUX
+    // Prefer the build relying on guard pages over software bounds checks where usable
+    if (wasmRunner == QStringLiteral("Wasmrunnerfast") && hardwareBoundsCheckUsable()) {
+        const auto hwRunner = QStringLiteral("Wasmrunnerfasthw");
+        if (QFileInfo::exists(QStringLiteral("%1/libtide-%2.so").arg(libsRoot, hwRunner)))
+            wasmRunner = hwRunner;
+    }
+
     if (m_forceDebugInterpreter || debug) {
         runnerPath = QStringLiteral("%1/libtide-%2.so").arg(libsRoot, wasmRunner).toStdString();
     } else {
@@ -205,8 +332,9 @@ void WasmRunner::start(const QString binary, const QStringList args, const bool
     }
 #endif
 
+    sharedData.runnerName = wasmRunner;
     sharedData.lib = wamr_runtime_load(runnerPath.c_str());
-    std::cout << "Loaded Wasmrunner " << sharedData.lib->handle << " from " << runnerPath << std::endl;
+    std::cout << "Using Wasmrunner " << sharedData.lib->handle << " from " << runnerPath << std::endl;
 
     if (sharedData.lib->init) {
         sharedData.runtime = sharedData.lib->init(m_runnerHost, (WasmRuntimeConfig)&sharedData.config);
@@ -215,6 +343,8 @@ void WasmRunner::start(const QString binary, const QStringList args, const bool
         sharedData.runtime = nullptr;
     }
 
+    qDebug() << "Runner ready after" << startupTimer.elapsed() << "ms";
+
     std::lock_guard<std::mutex> lk(sharedData.runMutex);
     pthread_create(&m_runThread, nullptr, runInThread, &sharedData);
     sharedData.running = true;
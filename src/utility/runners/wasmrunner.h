@@ -2,6 +2,7 @@
 #define WASMRUNNER_H
 
 #include <QObject>
+#include <QVariantMap>
 #include <pthread.h>
 #include <mutex>
 #include <string>
@@ -18,6 +19,7 @@ class WasmRunner;
 
 struct WasmRunnerSharedData {
     QString binary;
+    QString runnerName;
     QStringList args;
     int main_result;
     StdioSpec stdio;
@@ -41,6 +43,7 @@ public:
     virtual void reportError(const std::string& err) override;
     virtual void reportExit(const int code) override;
     virtual void reportDebugPort(const uint32_t debugPort) override;
+    virtual void reportMetrics(const WasmRunMetrics& metrics) override;
     WasmRunner* runner;
 };
 
@@ -51,6 +54,10 @@ class WasmRunner : public QObject
     Q_PROPERTY(bool running MEMBER m_running NOTIFY runningChanged CONSTANT)
     Q_PROPERTY(SystemGlue* system MEMBER m_system NOTIFY systemChanged)
     Q_PROPERTY(bool forceDebugInterpreter MEMBER m_forceDebugInterpreter NOTIFY forceDebugInterpreterChanged)
+    Q_PROPERTY(bool mapModules MEMBER m_mapModules NOTIFY mapModulesChanged)
+    Q_PROPERTY(bool preallocateMemory MEMBER m_preallocateMemory NOTIFY preallocateMemoryChanged)
+    Q_PROPERTY(bool tieredExecution MEMBER m_tieredExecution NOTIFY tieredExecutionChanged)
+    Q_PROPERTY(int tierUpThreshold MEMBER m_tierUpThreshold NOTIFY tierUpThresholdChanged)
 
 public:
     explicit WasmRunner(QObject *parent = nullptr);
@@ -66,6 +73,7 @@ public slots:
     void configure(unsigned int stack, unsigned int heap, unsigned int threads, bool opt);
     void run(const QString binary, const QStringList args, const bool exceptions);
     void debug(const QString binary, const QStringList args, const bool exceptions);
+    void profile(const QString binary, const QStringList args, const bool exceptions);
     void waitForFinished();
     int exitCode();
     void kill();
@@ -73,7 +81,7 @@ public slots:
     void registerDebugger(Debugger* debugger);
 
 private:
-    void start(const QString binary, const QStringList args, const bool debug, const bool exceptions);
+    void start(const QString binary, const QStringList args, const bool debug, const bool exceptions, const bool profile = false);
     void stop(bool silent);
 
     StdioSpec m_spec;
@@ -82,6 +90,10 @@ private:
     Debugger* m_debugger;
     bool m_running;
     bool m_forceDebugInterpreter;
+    bool m_mapModules;
+    bool m_preallocateMemory;
+    bool m_tieredExecution;
+    int m_tierUpThreshold;
     TideWasmRunnerHost* m_runnerHost;
 
 signals:
@@ -90,9 +102,14 @@ signals:
     void errorOccured(QString str);
     void runningChanged();
     void runEnded(int exitCode);
+    void metricsReported(QVariantMap metrics);
     void debugSessionStarted(int port);
     void systemChanged();
     void forceDebugInterpreterChanged();
+    void mapModulesChanged();
+    void preallocateMemoryChanged();
+    void tieredExecutionChanged();
+    void tierUpThresholdChanged();
 };
 
 #endif // WASMRUNNER_H